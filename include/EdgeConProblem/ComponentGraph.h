@@ -0,0 +1,120 @@
+/**
+ * @file ComponentGraph.h
+ * @brief  The quotient of an EdgeConGraph by its homogeneous components: a multigraph with one node per homogeneous
+ *         component and one edge per heterogeneous edge linking two different components.
+ * @version 1
+ * @date 2026-10-16
+ *
+ * @copyright Creative Commons.
+ *
+ */
+
+#ifndef COCA_COMPONENTGRAPH_H
+#define COCA_COMPONENTGRAPH_H
+
+#include "EdgeConGraph.h"
+
+/**
+ * @brief The quotient multigraph. Its nodes are the homogeneous components of an EdgeConGraph (numbered as in the
+ * EdgeConGraph), its edges are numbered from 0 to sizeCG - 1 in the lexicographic order of their endpoints in the
+ * original graph.
+ */
+typedef struct ComponentGraph_s *ComponentGraph;
+
+/**
+ * @brief Builds the quotient of @p graph by its current homogeneous components. The EdgeConGraph is not referenced
+ * afterwards, so later changes of its translators do not modify the result.
+ *
+ * @param graph An EdgeConGraph.
+ * @return ComponentGraph The quotient multigraph. Must be freed with deleteComponentGraph.
+ * @pre @p graph must be a valid EdgeConGraph with computed homogeneous components.
+ */
+ComponentGraph initializeComponentGraph(const EdgeConGraph graph);
+
+/**
+ * @brief Frees a ComponentGraph.
+ *
+ * @param cg A ComponentGraph.
+ */
+void deleteComponentGraph(ComponentGraph cg);
+
+/**
+ * @brief Returns the number of nodes (homogeneous components) of @p cg.
+ *
+ * @param cg A ComponentGraph.
+ * @return int Its number of nodes.
+ */
+int orderCG(const ComponentGraph cg);
+
+/**
+ * @brief Returns the number of edges (heterogeneous edges between distinct components) of @p cg.
+ *
+ * @param cg A ComponentGraph.
+ * @return int Its number of edges.
+ */
+int sizeCG(const ComponentGraph cg);
+
+/**
+ * @brief Gets the nodes of the original graph linked by the edge @p edge, with @p node1 < @p node2.
+ *
+ * @param cg A ComponentGraph.
+ * @param edge An edge of @p cg.
+ * @param node1 Will contain the smaller node of the edge.
+ * @param node2 Will contain the greater node of the edge.
+ * @pre 0 <= @p edge < sizeCG(@p cg)
+ */
+void getEdgeNodes(const ComponentGraph cg, int edge, int *node1, int *node2);
+
+/**
+ * @brief Gets the components linked by the edge @p edge: @p component1 contains the smaller node of the edge and
+ * @p component2 the greater one.
+ *
+ * @param cg A ComponentGraph.
+ * @param edge An edge of @p cg.
+ * @param component1 Will contain the component of the smaller node of the edge.
+ * @param component2 Will contain the component of the greater node of the edge.
+ * @pre 0 <= @p edge < sizeCG(@p cg)
+ */
+void getEdgeComponents(const ComponentGraph cg, int edge, int *component1, int *component2);
+
+/**
+ * @brief Returns the edges incident to the component @p component, grouped by adjacent component (in increasing
+ * order of adjacent component).
+ *
+ * @param cg A ComponentGraph.
+ * @param component A component.
+ * @param edges Will point to the array of incident edges. It belongs to @p cg and must not be freed.
+ * @return int The number of edges incident to @p component.
+ * @pre 0 <= @p component < orderCG(@p cg)
+ */
+int getEdgesOfComponent(const ComponentGraph cg, int component, const int **edges);
+
+/**
+ * @brief Returns the edges linking the components @p component1 and @p component2, in increasing order. The lookup
+ * is a binary search among the components adjacent to @p component1.
+ *
+ * @param cg A ComponentGraph.
+ * @param component1 A component.
+ * @param component2 A component.
+ * @param edges Will point to the array of edges between the two components, or be NULL if there is none. It
+ * belongs to @p cg and must not be freed.
+ * @return int The number of edges between @p component1 and @p component2.
+ * @pre 0 <= @p component1, @p component2 < orderCG(@p cg)
+ */
+int getEdgesBetweenComponents(const ComponentGraph cg, int component1, int component2, const int **edges);
+
+/**
+ * @brief Computes the sum of the diameters of the trees of a forest of @p cg, each by two breadth-first searches, in
+ * time linear in the number of components. The cost of communication between two nodes of the original graph being
+ * the distance between their components in the tree induced by the translators, the diameter of a spanning tree is
+ * the cost of its translator set.
+ *
+ * @param cg A ComponentGraph.
+ * @param forestEdges The edges of the forest.
+ * @param numEdges The number of edges of the forest.
+ * @return int The sum of the diameters of the trees of the forest (isolated components included, with diameter 0).
+ * @pre The edges of @p forestEdges do not form a cycle.
+ */
+int sumOfTreeDiameters(const ComponentGraph cg, const int *forestEdges, int numEdges);
+
+#endif
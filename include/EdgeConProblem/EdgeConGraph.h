@@ -120,7 +120,8 @@ int getNumHeteregeneousEdges(const EdgeConGraph graph);
 /**
  * @brief Sets the edge (@p node1,@p node2) to be a translator. Warning:
  * DOES NOT recompute homogeneous components, you must use
- * computesHomogeneousComponents if you wont them to be updated.
+ * computesHomogeneousComponents if you wont them to be updated, unless the
+ * incremental mode is enabled (see setIncrementalComponents).
  *
  * @param graph A EdgeConGraph.
  * @param node1 A node.
@@ -134,7 +135,8 @@ void addTranslator(EdgeConGraph graph, int node1, int node2);
 /**
  * @brief Sets the edge (@p node1,@p node2) to not be a translator. Warning:
  * DOES NOT recompute homogeneous components, you must use
- * computesHomogeneousComponents if you wont them to be updated.
+ * computesHomogeneousComponents if you wont them to be updated, unless the
+ * incremental mode is enabled (see setIncrementalComponents).
  *
  * @param graph A EdgeConGraph.
  * @param node1 A node.
@@ -165,6 +167,24 @@ bool isTranslator(const EdgeConGraph graph, int node1, int node2);
  */
 void computesHomogeneousComponents(EdgeConGraph graph);
 
+/**
+ * @brief Enables or disables the incremental maintenance of the homogeneous
+ * components. In incremental mode, addTranslator merges the components of its
+ * endpoints and removeTranslator undoes this merge, both in near-constant
+ * time, so getNumComponents and areInSameComponent are always up to date.
+ * Removing the most recently added translator is the cheap case (as in a
+ * depth-first search); removing an older one replays the translators added
+ * after it. The numbering of components (isNodeInComponent,
+ * getComponentOfNode) is only refreshed by computesHomogeneousComponents,
+ * which in this mode does not explore the graph.
+ *
+ * @param graph A EdgeConGraph.
+ * @param incremental True to enable the incremental mode, false to disable it.
+ *
+ * @pre @p graph must be a valid EdgeConGraph.
+ */
+void setIncrementalComponents(EdgeConGraph graph, bool incremental);
+
 /**
  * @brief Tests if @p node1 and @p node2 are in the same homogeneous component.
  *
@@ -191,6 +211,18 @@ bool areInSameComponent(const EdgeConGraph graph, int node1, int node2);
  */
 bool isNodeInComponent(const EdgeConGraph graph, int node, int component);
 
+/**
+ * @brief Get the number of the homogeneous component of @p node. Components are numbered from 0 to
+ * getNumComponents(@p graph) - 1, in the order of their smallest node.
+ *
+ * @param graph An EdgeConGraph
+ * @param node A node
+ * @return int The number of the component containing @p node
+ *
+ * @pre @p node < @p graph.graph.numNodes
+ */
+int getComponentOfNode(const EdgeConGraph graph, int node);
+
 /**
  * @brief Get the number of homogeneous components in @p graph.
  *
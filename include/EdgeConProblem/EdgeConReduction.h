@@ -19,6 +19,8 @@
 
 #include "Graph.h"
 #include "EdgeConGraph.h"
+#include "Z3Tools.h"
+#include <stdio.h>
 #include <z3.h>
 
 /**
@@ -58,6 +60,49 @@ Z3_ast getVariableParent(Z3_context ctx, int child, int parent);
  */
 Z3_ast getVariableLevelInSpanningTree(Z3_context ctx, int level, int component);
 
+/**
+ * @brief The encodings of the "at most one" constraints of the reduction (at
+ * most one edge per translator, one translator per edge, one parent per
+ * component and one level per component).
+ */
+typedef enum
+{
+    AMO_PAIRWISE,   ///< One clause per pair of variables, no auxiliary variable. Quadratic size.
+    AMO_SEQUENTIAL, ///< Sequential counter (Sinz, 2005): n - 1 auxiliary variables, 3n - 4 clauses.
+    AMO_PRODUCT,    ///< Product encoding (Chen, 2010): 2 sqrt(n) auxiliary variables, 2n + o(n) clauses.
+    AMO_PB          ///< Pseudo-boolean constraint of Z3 (Z3_mk_atmost). The DIMACS output uses AMO_SEQUENTIAL instead.
+} AtMostOneEncoding;
+
+/**
+ * @brief Sets the encoding of the "at most one" constraints used by the
+ * following calls to EdgeConReduction. Default is AMO_PAIRWISE.
+ *
+ * @param encoding The encoding.
+ */
+void setAtMostOneEncoding(AtMostOneEncoding encoding);
+
+/**
+ * @brief Gets the encoding whose name is @p name.
+ *
+ * @param name One of "pairwise", "sequential", "product" or "pb".
+ * @param encoding Will contain the encoding.
+ * @return true If @p name is the name of an encoding.
+ * @return false Otherwise (@p encoding is then unchanged).
+ */
+bool getAtMostOneEncodingFromName(const char *name, AtMostOneEncoding *encoding);
+
+/**
+ * @brief Enables or disables the symmetry breaking constraints in the
+ * following calls to EdgeConReduction. Disabled by default. The translators
+ * used are then numbered from 0 in increasing order of their edges, so that
+ * each translator set has a single numbering instead of up to N! of them.
+ * This does not change the satisfiability of the formula, since only the set
+ * of translator edges matters.
+ *
+ * @param enabled true to add the constraints.
+ */
+void setSymmetryBreaking(bool enabled);
+
 /**
  * @brief Generates a SAT formula satisfiable if and only if there is a set of
  * translators of cost @p cost such that the graph admits a valid path between
@@ -71,6 +116,68 @@ Z3_ast getVariableLevelInSpanningTree(Z3_context ctx, int level, int component);
  */
 Z3_ast EdgeConReduction(Z3_context ctx, const EdgeConGraph graph, int cost);
 
+/**
+ * @brief Writes the formula of EdgeConReduction in DIMACS CNF format, without
+ * building it in Z3. The variables are numbered from 1 as in the reduction:
+ * with m edges (u, v), u < v, numbered in lexicographic order, N = C - 1
+ * translators and C homogeneous components, x_[(u,v),i] of the e-th edge is
+ * e * N + i + 1, p_[child,parent] is m * N + child * C + parent + 1 and
+ * l_[component,level] (with C levels, from 0 to N) is
+ * m * N + C * C + component * C + level + 1. The
+ * auxiliary variables of the "at most one" encodings come next.
+ *
+ * The clauses go through a temporary file until their number, needed by
+ * the header, is known, so the formula is only generated once.
+ *
+ * @param file The output, opened for writing (a file or a pipe).
+ * @param graph A EdgeConGraph.
+ * @param cost The cost of the translator set.
+ * @return int The number of variables, or -1 if the temporary file cannot be
+ * created or the formula cannot be written.
+ * @pre graph must be an initialized EdgeConGraph with computed connected components.
+ */
+int EdgeConReductionToDimacs(FILE *file, const EdgeConGraph graph, int cost);
+
+/**
+ * @brief Writes the formula of EdgeConReduction as an SMT-LIB2 script, one
+ * assertion per clause as it is generated, without building it in Z3: only a
+ * clause is kept in memory at a time. The variables have the names given by
+ * the getVariable functions (as quoted symbols), the auxiliary variables are
+ * named aux_ followed by their number in EdgeConReductionToDimacs. With
+ * AMO_PB, the "at most one" constraints use the at-most operator of Z3.
+ *
+ * @param file The output, opened for writing.
+ * @param graph A EdgeConGraph.
+ * @param cost The cost of the translator set.
+ * @pre graph must be an initialized EdgeConGraph with computed connected components.
+ */
+void EdgeConReductionToSmtLib(FILE *file, const EdgeConGraph graph, int cost);
+
+/**
+ * @brief Computes the smallest cost k such that every translator set allows
+ * all nodes to communicate with cost at most k, that is the largest diameter
+ * of a tree of homogeneous components, as found by BruteForceEdgeCon and
+ * BranchAndBoundEdgeCon. It uses a single solver: the
+ * part of the formula not depending on the cost is built and asserted once,
+ * and each cost is checked under an assumption enabling its own level
+ * constraint, so that what the solver learns is kept from one check to the
+ * next. The costs are binary searched.
+ *
+ * @param session The solver session, with its parameters set. The formula is
+ * asserted in its solver.
+ * @param graph A EdgeConGraph.
+ * @param model Will contain a model of the formula for the returned cost
+ * minus one (a translator set of cost exactly the returned cost), or NULL if
+ * no check was satisfiable. Must be released with Z3_model_dec_ref if not
+ * NULL. The returned cost is only known to be reached when there is a
+ * model; otherwise it is only an upper bound.
+ * @return int The cost, 0 if there is no valid translator set (or a single
+ * homogeneous component), or -1 if the solver could not decide one of the
+ * checks.
+ * @pre graph must be an initialized EdgeConGraph with computed connected components.
+ */
+int EdgeConMaximalCost(Z3Session session, const EdgeConGraph graph, Z3_model *model);
+
 /**
  * @brief Gets the translator set from a model and adds it to the EdgeConGraph.
  * It also computes the homogeneous components taking into account the
@@ -86,4 +193,18 @@ Z3_ast EdgeConReduction(Z3_context ctx, const EdgeConGraph graph, int cost);
  */
 void getTranslatorSetFromModel(Z3_context ctx, Z3_model model, EdgeConGraph graph);
 
+/**
+ * @brief Same as getTranslatorSetFromModel, for an assignment of the variables
+ * of EdgeConReductionToDimacs.
+ *
+ * @param assignment The value of each variable, indexed by its number.
+ * @param graph A EdgeConGraph.
+ *
+ * @pre @p assignment must satisfy the formula written by
+ * EdgeConReductionToDimacs for @p graph.
+ * @pre @p graph must be a valid EdgeConGraph with no translators (or at least
+ * the original number of homogeneous components).
+ */
+void getTranslatorSetFromAssignment(const bool *assignment, EdgeConGraph graph);
+
 #endif
@@ -14,6 +14,9 @@
 
 #include "EdgeConGraph.h"
 
+/** The largest number of threads used by ParallelBruteForceEdgeCon. */
+#define MAX_BRUTE_FORCE_THREADS 256
+
 /**
  * @brief Brute Force Algorithm. If there is a result, the solution will be
  * stored in @param graph, and its homogeneous components updated. If no
@@ -29,4 +32,51 @@
  */
 int BruteForceEdgeCon(EdgeConGraph graph);
 
+/**
+ * @brief Brute Force Algorithm using @p numThreads threads. The translator
+ * sets (spanning trees of the homogeneous components) are grouped by their
+ * smallest edges, in many more groups than threads so that the work is
+ * balanced, and the groups are shared between the threads, which all stop as
+ * soon as one of them finds a set refuting the current cost. Same result as
+ * BruteForceEdgeCon.
+ *
+ * @param graph An instance of the problem.
+ * @param numThreads The number of threads to use, at most
+ * MAX_BRUTE_FORCE_THREADS (a larger number is lowered to it). Fewer threads
+ * are used if there are few translator sets.
+ * @return the maximal cost that two nodes communicate with for any possible
+ * set of transducers of minimal size. Returns -1 if there is no solution (i.e.,
+ * the graph is not connex).
+ *
+ * @pre graph must be valid.
+ * @pre @p numThreads >= 1.
+ */
+int ParallelBruteForceEdgeCon(EdgeConGraph graph, int numThreads);
+
+/**
+ * @brief Counters of a search.
+ */
+typedef struct
+{
+    long long numExploredNodes; ///< The number of nodes of the search tree explored.
+    long long numPrunedNodes;   ///< The number of nodes whose subtree was cut by the bound.
+} SearchStatistics;
+
+/**
+ * @brief Branch and Bound Algorithm. Translators are added one by one in a
+ * depth-first search, and a partial set is abandoned as soon as no way to
+ * complete it can cost more than the best complete set found so far. The
+ * cost of a translator set is the diameter of the tree it induces on the
+ * homogeneous components.
+ *
+ * @param graph An instance of the problem.
+ * @param statistics If not NULL, will contain the counters of the search.
+ * @return the maximal cost that two nodes communicate with for any possible
+ * set of transducers of minimal size. Returns -1 if there is no solution (i.e.,
+ * the graph is not connex).
+ *
+ * @pre graph must be valid.
+ */
+int BranchAndBoundEdgeCon(EdgeConGraph graph, SearchStatistics *statistics);
+
 #endif
@@ -0,0 +1,149 @@
+/**
+ * @file Bitset.h
+ * @brief  Sets of integers packed in 64-bit words, and square bit matrices made of such sets (one per row). Used to store
+ *         adjacency-like relations with one bit per pair, and to apply operations on 64 elements at once.
+ * @version 1
+ * @date 2026-10-16
+ *
+ * @copyright Creative Commons.
+ *
+ */
+
+#ifndef COCA_BITSET_H_
+#define COCA_BITSET_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/** @brief The number of bits in a word of a bitset. */
+#define BITSET_WORD_BITS 64
+
+/**
+ * @brief Returns the number of words needed to store @p numBits bits.
+ *
+ * @param numBits A number of bits.
+ * @return int The number of words of a bitset of @p numBits bits.
+ */
+int numWordsOfBitset(int numBits);
+
+/**
+ * @brief Creates a bitset of @p numBits bits, all set to 0. Must be freed with deleteBitset.
+ *
+ * @param numBits The number of bits of the set.
+ * @return uint64_t* The created bitset.
+ */
+uint64_t *createBitset(int numBits);
+
+/**
+ * @brief Creates a matrix of @p numRows rows of @p numBits bits each, all set to 0. Row i starts at word
+ *        i*numWordsOfBitset(@p numBits) (see getBitsetRow). Must be freed with deleteBitset.
+ *
+ * @param numRows The number of rows.
+ * @param numBits The number of bits of each row.
+ * @return uint64_t* The created matrix.
+ */
+uint64_t *createBitMatrix(int numRows, int numBits);
+
+/**
+ * @brief Frees a bitset or a bit matrix.
+ *
+ * @param set A bitset created by createBitset or createBitMatrix.
+ */
+void deleteBitset(uint64_t *set);
+
+/**
+ * @brief Sets all the words of @p set to 0.
+ *
+ * @param set A bitset.
+ * @param numWords The number of words of @p set.
+ */
+void clearBitset(uint64_t *set, int numWords);
+
+/**
+ * @brief Counts the bits set to 1 in @p set.
+ *
+ * @param set A bitset.
+ * @param numWords The number of words of @p set.
+ * @return int The number of bits set in @p set.
+ */
+int countBits(const uint64_t *set, int numWords);
+
+/**
+ * @brief Counts the bits set to 1 in @p set whose index is at least @p from.
+ *
+ * @param set A bitset.
+ * @param numWords The number of words of @p set.
+ * @param from The smallest index to count.
+ * @return int The number of bits of index at least @p from set in @p set.
+ */
+int countBitsFrom(const uint64_t *set, int numWords, int from);
+
+/**
+ * @brief Returns the smallest index at least @p from whose bit is set in @p set.
+ *
+ * @param set A bitset.
+ * @param numWords The number of words of @p set.
+ * @param from The smallest index to consider.
+ * @return int The index of the next set bit, or -1 if there is none.
+ */
+int nextSetBit(const uint64_t *set, int numWords, int from);
+
+/**
+ * @brief Returns the smallest index at least @p from whose bit is not set in @p set.
+ *
+ * @param set A bitset.
+ * @param numBits The number of bits of @p set.
+ * @param from The smallest index to consider.
+ * @return int The index of the next unset bit, or -1 if all bits from @p from to @p numBits - 1 are set.
+ */
+int nextUnsetBit(const uint64_t *set, int numBits, int from);
+
+/**
+ * @brief Returns the row @p row of a bit matrix.
+ *
+ * @param matrix A bit matrix.
+ * @param numWords The number of words of a row (numWordsOfBitset of the number of columns).
+ * @param row The row.
+ * @return uint64_t* The bitset of row @p row.
+ */
+static inline uint64_t *getBitsetRow(uint64_t *matrix, int numWords, int row)
+{
+    return matrix + (int64_t)row * numWords;
+}
+
+/**
+ * @brief Tells if bit @p bit is set in @p set.
+ *
+ * @param set A bitset.
+ * @param bit An index.
+ * @return true If bit @p bit is set.
+ * @return false Otherwise.
+ */
+static inline bool testBit(const uint64_t *set, int bit)
+{
+    return (set[bit / BITSET_WORD_BITS] >> (bit % BITSET_WORD_BITS)) & 1;
+}
+
+/**
+ * @brief Sets bit @p bit to 1 in @p set.
+ *
+ * @param set A bitset.
+ * @param bit An index.
+ */
+static inline void setBit(uint64_t *set, int bit)
+{
+    set[bit / BITSET_WORD_BITS] |= (uint64_t)1 << (bit % BITSET_WORD_BITS);
+}
+
+/**
+ * @brief Sets bit @p bit to 0 in @p set.
+ *
+ * @param set A bitset.
+ * @param bit An index.
+ */
+static inline void clearBit(uint64_t *set, int bit)
+{
+    set[bit / BITSET_WORD_BITS] &= ~((uint64_t)1 << (bit % BITSET_WORD_BITS));
+}
+
+#endif
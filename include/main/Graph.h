@@ -15,6 +15,8 @@
 #define COCA_GRAPH_H_
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 
 /** @brief: the graph type. The first four fields are needed to represent a directed graph. The rest depends on needs. Here, the rest represents initial and final states of an automaton.*/
@@ -22,7 +24,10 @@ typedef struct {
 	int numNodes; ///< The number of nodes of the graph.
 	int numEdges; ///< The number of edges of the graph.
 	char** nodes; ///< The names of nodes of the graph.
-	bool* edges;	  ///< The edges of the graph.
+	char* names;  ///< The characters of the names of the nodes and of the colors, in a single block: nodes and colorNames point into it.
+	uint64_t* edges;	  ///< The edges of the graph, as a bit matrix: row i (numWordsOfBitset(numNodes) words, see Bitset.h) is the set of neighbours of node i.
+	int* neighbourOffsets;	///< Compressed adjacency: the neighbours of node i are stored in neighbours[neighbourOffsets[i]] to neighbours[neighbourOffsets[i+1]-1]. Array of size numNodes+1.
+	int* neighbours;	///< Compressed adjacency: the neighbours of every node, in increasing order for each node.
 
 //These are to handle colored graphs.
 	int numColor;	///< The number of different colors.
@@ -32,6 +37,10 @@ typedef struct {
 //This is only for dealing with automata. May be changed according to needs.
 	bool *initial;	///< Array of source nodes.
 	bool *final;	///< Array of target nodes.
+
+//This is only for graphs loaded by loadGraphBinary.
+	void* mapping;	///< The binary file the graph was loaded from, mapped in memory: neighbourOffsets, neighbours, color, initial, final and names point into it. NULL if the graph was not loaded from a binary file.
+	size_t mappingSize;	///< The size of mapping.
 } Graph;
 
 /**
@@ -43,6 +52,27 @@ typedef struct {
  */
 Graph copyGraph(Graph graph);
 
+/**
+ * @brief Writes a graph in a binary file, which loadGraphBinary reads much faster than a .dot file is parsed. The file contains a versioned header, followed by the compressed adjacency, the colors, the initial and final nodes, and a table of the names of the nodes and of the colors. Integers are written in the byte order of the machine.
+ * 
+ * @param graph A graph.
+ * @param fileName The name of the file to write.
+ * @return true If the file was written.
+ * @return false Otherwise, after displaying an error message.
+ * @pre @p graph must be a valid graph.
+ */
+bool saveGraphBinary(Graph graph, const char *fileName);
+
+/**
+ * @brief Loads a graph from a binary file written by saveGraphBinary. The file is mapped in memory and its arrays are used in place, only the edge matrix and the arrays of names are built.
+ * 
+ * @param fileName The name of the file to read.
+ * @param graph Will contain the graph, to be deleted with deleteGraph.
+ * @return true If the graph was loaded.
+ * @return false If the file cannot be read, is not a binary graph file of the current version, or is inconsistent (names or neighbours out of range, unsorted or repeated neighbours, number of edges matching neither an undirected nor a directed graph), after displaying an error message.
+ */
+bool loadGraphBinary(const char *fileName, Graph *graph);
+
 /**
  * @brief Displays a graph with a list of nodes and a matrix of edges.
  * 
@@ -95,6 +125,47 @@ int sizeG(Graph graph);
  */
 bool isEdge(Graph graph, int source, int target);
 
+/**
+ * @brief Returns the number of neighbours of @p node in @p graph (its successors if the graph is directed).
+ * 
+ * @param graph A graph.
+ * @param node A node.
+ * @return int The number of neighbours of @p node.
+ * @pre @p graph must be a valid graph.
+ * @pre 0 <= @p node < @p graph.numNodes
+ */
+int degreeG(Graph graph, int node);
+
+/**
+ * @brief Returns the neighbours of @p node in @p graph, sorted in increasing order. Iterating over this array instead of testing isEdge against every node makes a traversal of the graph linear in its number of edges.
+ * 
+ * @param graph A graph.
+ * @param node A node.
+ * @return int* An array of size degreeG(@p graph, @p node) containing the neighbours of @p node. It belongs to @p graph and must not be freed.
+ * @pre @p graph must be a valid graph.
+ * @pre 0 <= @p node < @p graph.numNodes
+ */
+int* getNeighbours(Graph graph, int node);
+
+/**
+ * @brief Returns the set of neighbours of @p node, as a bitset of numWordsOfBitset(orderG(@p graph)) words (see Bitset.h).
+ * 
+ * @param graph A graph.
+ * @param node A node.
+ * @return uint64_t* The bitset of neighbours of @p node. It belongs to @p graph and must not be freed.
+ * @pre @p graph must be a valid graph.
+ * @pre 0 <= @p node < @p graph.numNodes
+ */
+uint64_t* getNeighbourSet(Graph graph, int node);
+
+/**
+ * @brief Computes the compressed adjacency (fields neighbourOffsets and neighbours) of @p graph from its edge matrix. Must be called once the edges are set.
+ * 
+ * @param graph A pointer to a graph whose edges are set.
+ * @pre @p graph->edges must be filled.
+ */
+void computeNeighbours(Graph *graph);
+
 /**
  * @brief Get the Color of a node
  * 
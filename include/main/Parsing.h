@@ -19,6 +19,7 @@
 
 /**
  * @brief Parses a file and return the Graph described by it. If the file with the name given in argument does not exists, it displays an error message and exits the program.
+ *        The state of the parsing is local to each call, so several threads can load graphs at the same time.
  * 
  * @param toRead the name of a file in graphviz format.
  * @return GraphList The parsed GraphList.
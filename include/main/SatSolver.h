@@ -0,0 +1,43 @@
+/**
+ * @file SatSolver.h
+ * @brief Runs an external SAT solver (kissat, cadical, minisat...) installed on the machine on a formula in DIMACS CNF
+ *        format, and reads its answer back.
+ * @version 1
+ * @date 2026-10-16
+ *
+ * @copyright Creative Commons
+ *
+ */
+
+#ifndef COCA_SATSOLVER_H_
+#define COCA_SATSOLVER_H_
+
+#include <stdbool.h>
+
+/**
+ * @brief The answer of a SAT solver.
+ */
+typedef enum
+{
+    SAT_SATISFIABLE,   ///< The formula is satisfiable.
+    SAT_UNSATISFIABLE, ///< The formula is unsatisfiable.
+    SAT_UNKNOWN        ///< The solver could not decide, or could not be run.
+} SatAnswer;
+
+/**
+ * @brief Solves a DIMACS file with an external solver. Solvers printing their answer in the format of the SAT competition
+ *        ("s SATISFIABLE" and "v" lines, like kissat or cadical) are read from their standard output, minisat is given a
+ *        second file to write its model in, created with a name that cannot be guessed. The solver is run directly, not
+ *        by a shell.
+ *
+ * @param solver The command running the solver, looked up in the PATH, with its options if any separated by spaces
+ *        (example: "kissat -q"). Quotes and other shell syntax are not interpreted.
+ * @param fileName The name of the DIMACS file.
+ * @param numVariables The number of variables of the formula.
+ * @param assignment An array of @p numVariables + 1 booleans. If the formula is satisfiable, @p assignment[v] is the
+ *        value of the variable v in the model found.
+ * @return SatAnswer The answer of the solver, SAT_UNKNOWN if the solver could not be run.
+ */
+SatAnswer solveDimacsFile(const char *solver, const char *fileName, int numVariables, bool *assignment);
+
+#endif
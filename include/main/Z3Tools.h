@@ -16,6 +16,8 @@
 
 #include <z3.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
 
 /**
  * @brief Creates a basic Z3 context with basic config (sufficient for this project). Must be freed at end of program with Z3_del_context.
@@ -77,4 +79,146 @@ Z3_lbool solveFormula(Z3_context ctx, Z3_ast formula, Z3_model* model);
  */
 bool valueOfVarInModel(Z3_context ctx, Z3_model model, Z3_ast variable);
 
+/**
+ * @brief Gets the truth values of many variables in @p model at once: the constants of the model are read once and
+ *        matched with the variables by the ids of their declarations, instead of evaluating each variable. A variable
+ *        without interpretation (whose value does not matter) is false.
+ *
+ * @param ctx The context of the solver.
+ * @param model A variable assignment.
+ * @param numVars The number of variables.
+ * @param vars The variables (formulas made of a single variable, as given by mk_bool_var).
+ * @param values A bitset of at least @p numVars bits (see Bitset.h). Bit i will be set if @p vars[i] is true in @p
+ *        model, and cleared otherwise.
+ * @pre @p model must be a valid model.
+ */
+void valuesOfVarsInModel(Z3_context ctx, Z3_model model, int numVars, const Z3_ast *vars, uint64_t *values);
+
+/**
+ * @brief A solver kept between checks: formulas can be asserted incrementally, and what the solver learns is kept from
+ *        one check to the next.
+ */
+typedef struct Z3Session_s *Z3Session;
+
+/**
+ * @brief Creates a session with an empty solver.
+ *
+ * @param ctx The context of the solver.
+ * @return Z3Session The session. Must be freed with deleteZ3Session.
+ */
+Z3Session createZ3Session(Z3_context ctx);
+
+/**
+ * @brief Frees a session and its solver (and its last model).
+ *
+ * @param session A session.
+ */
+void deleteZ3Session(Z3Session session);
+
+/**
+ * @brief Gets the context of the solver of a session.
+ *
+ * @param session A session.
+ * @return Z3_context The context given to createZ3Session.
+ */
+Z3_context getZ3SessionContext(Z3Session session);
+
+/**
+ * @brief Gets the solver of a session, for calls not covered by this API.
+ *
+ * @param session A session.
+ * @return Z3_solver The solver, owned by @p session.
+ */
+Z3_solver getZ3SessionSolver(Z3Session session);
+
+/**
+ * @brief Sets an unsigned integer parameter of the solver (see the Z3 documentation of the solver parameters, for
+ *        example "timeout" or "rlimit"). The parameters set are kept for all the following checks.
+ *
+ * @param session A session.
+ * @param name The name of the parameter.
+ * @param value The value of the parameter.
+ */
+void setZ3SessionUintParameter(Z3Session session, const char *name, unsigned int value);
+
+/**
+ * @brief Sets a boolean parameter of the solver, see setZ3SessionUintParameter.
+ *
+ * @param session A session.
+ * @param name The name of the parameter.
+ * @param value The value of the parameter.
+ */
+void setZ3SessionBoolParameter(Z3Session session, const char *name, bool value);
+
+/**
+ * @brief Limits the time of each following check. A check running out of time returns Z3_L_UNDEF.
+ *
+ * @param session A session.
+ * @param milliseconds The time limit, 0 for none.
+ */
+void setZ3SessionTimeout(Z3Session session, unsigned int milliseconds);
+
+/**
+ * @brief Limits the resources (an abstract, deterministic count of the work done by Z3) of each following check, so
+ *        that the result does not depend on the speed of the machine. A check running out of resources returns
+ *        Z3_L_UNDEF.
+ *
+ * @param session A session.
+ * @param limit The resource limit, 0 for none.
+ */
+void setZ3SessionResourceLimit(Z3Session session, unsigned int limit);
+
+/**
+ * @brief Adds a formula to the solver of a session, in addition to the formulas already asserted.
+ *
+ * @param session A session.
+ * @param formula A formula.
+ */
+void assertInZ3Session(Z3Session session, Z3_ast formula);
+
+/**
+ * @brief Checks if the conjunction of the formulas asserted in a session is satisfiable.
+ *
+ * @param session A session.
+ * @return Z3_lbool Z3_L_FALSE if it is unsatisfiable, Z3_L_TRUE if it is satisfiable and Z3_L_UNDEF if the solver
+ *         cannot decide it (or ran out of time or resources).
+ */
+Z3_lbool checkZ3Session(Z3Session session);
+
+/**
+ * @brief Same as checkZ3Session, under assumptions that are only taken into account by this check.
+ *
+ * @param session A session.
+ * @param numAssumptions The number of assumptions.
+ * @param assumptions The assumptions, which must be variables or negations of variables.
+ * @return Z3_lbool The answer, see checkZ3Session.
+ */
+Z3_lbool checkZ3SessionAssumptions(Z3Session session, int numAssumptions, const Z3_ast *assumptions);
+
+/**
+ * @brief Gets the model found by the last check of a session.
+ *
+ * @param session A session.
+ * @return Z3_model The model, owned by @p session and valid until its next check (use Z3_model_inc_ref to keep it), or
+ *         NULL if the last check did not answer Z3_L_TRUE.
+ */
+Z3_model getZ3SessionModel(Z3Session session);
+
+/**
+ * @brief Gets the reason why the last check of a session answered Z3_L_UNDEF (for example "timeout" or "max. resource
+ *        limit exceeded").
+ *
+ * @param session A session.
+ * @return const char* The reason, valid until the next call to Z3.
+ */
+const char *getZ3SessionReasonUnknown(Z3Session session);
+
+/**
+ * @brief Writes the statistics of the solver of a session (conflicts, decisions, memory...) about its checks so far.
+ *
+ * @param session A session.
+ * @param file The output.
+ */
+void printZ3SessionStatistics(Z3Session session, FILE *file);
+
 #endif
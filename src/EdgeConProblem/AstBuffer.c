@@ -0,0 +1,137 @@
+#include "AstBuffer.h"
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+/** The default number of formulas of a block. */
+#define AST_CHUNK_CAPACITY (1 << 16)
+
+/**
+ * @brief A block of memory of an arena.
+ */
+typedef struct AstChunk_s
+{
+    struct AstChunk_s *previous; ///< The block below in the stack of blocks (or in the list of spare blocks).
+    int capacity;                ///< The number of formulas the block can contain.
+    int used;                    ///< The number of formulas used by open buffers.
+    Z3_ast asts[];               ///< The formulas.
+} AstChunk;
+
+struct AstArena_s
+{
+    AstChunk *top;   ///< The block containing the last open buffer.
+    AstChunk *spare; ///< Blocks given back by closed buffers, kept to be reused.
+};
+
+AstArena createAstArena(void)
+{
+    AstArena arena = (AstArena)malloc(sizeof(*arena));
+    assert(NULL != arena);
+    arena->top = NULL;
+    arena->spare = NULL;
+    return arena;
+}
+
+static void deleteChunks(AstChunk *chunk)
+{
+    while (NULL != chunk)
+    {
+        AstChunk *previous = chunk->previous;
+        free(chunk);
+        chunk = previous;
+    }
+}
+
+void deleteAstArena(AstArena arena)
+{
+    deleteChunks(arena->top);
+    deleteChunks(arena->spare);
+    free(arena);
+}
+
+/**
+ * @brief Puts on top of the stack of blocks of @p arena an empty block of at least @p capacity formulas, reusing a
+ * spare block if one is large enough.
+ *
+ * @param arena An arena.
+ * @param capacity The minimal capacity of the block.
+ * @return AstChunk* The new top block.
+ */
+static AstChunk *pushChunk(AstArena arena, int capacity)
+{
+    AstChunk **spare = &arena->spare;
+    AstChunk *chunk;
+
+    while (NULL != *spare && (*spare)->capacity < capacity)
+        spare = &(*spare)->previous;
+    if (NULL != *spare)
+    {
+        chunk = *spare;
+        *spare = chunk->previous;
+    }
+    else
+    {
+        if (capacity < AST_CHUNK_CAPACITY)
+            capacity = AST_CHUNK_CAPACITY;
+        chunk = (AstChunk *)malloc(sizeof(AstChunk) + capacity * sizeof(Z3_ast));
+        assert(NULL != chunk);
+        chunk->capacity = capacity;
+    }
+    chunk->used = 0;
+    chunk->previous = arena->top;
+    arena->top = chunk;
+    return chunk;
+}
+
+AstBuffer openAstBuffer(AstArena arena)
+{
+    AstBuffer buffer;
+
+    if (NULL == arena->top)
+        pushChunk(arena, AST_CHUNK_CAPACITY);
+    buffer.arena = arena;
+    buffer.chunk = arena->top;
+    buffer.start = arena->top->used;
+    buffer.size = 0;
+    return buffer;
+}
+
+void pushAst(AstBuffer *buffer, Z3_ast ast)
+{
+    AstChunk *chunk = buffer->chunk;
+
+    if (chunk->used == chunk->capacity)
+    {
+        // Moves the buffer to a block twice as large, on top of the current one.
+        AstChunk *larger = pushChunk(buffer->arena, 2 * buffer->size + 1);
+        memcpy(larger->asts, chunk->asts + buffer->start, buffer->size * sizeof(Z3_ast));
+        larger->used = buffer->size;
+        chunk->used = buffer->start;
+        buffer->chunk = larger;
+        buffer->start = 0;
+        chunk = larger;
+    }
+    chunk->asts[chunk->used++] = ast;
+    buffer->size++;
+}
+
+Z3_ast *getAsts(const AstBuffer *buffer)
+{
+    return buffer->chunk->asts + buffer->start;
+}
+
+void closeAstBuffer(AstBuffer *buffer)
+{
+    AstArena arena = buffer->arena;
+
+    buffer->chunk->used = buffer->start;
+    // Blocks left empty above the previous buffers become spare.
+    while (0 == arena->top->used && NULL != arena->top->previous)
+    {
+        AstChunk *chunk = arena->top;
+        arena->top = chunk->previous;
+        chunk->previous = arena->spare;
+        arena->spare = chunk;
+    }
+    buffer->size = 0;
+}
@@ -0,0 +1,81 @@
+/**
+ * @file AstBuffer.h
+ * @brief Growable arrays of Z3 formulas, allocated in a stack-like arena. Formula builders open a buffer, push the
+ * sub-formulas into it, build the formula from it and close it. Buffers are nested like the builders calls, so the
+ * open buffer being filled is always the last one, can grow in place and gives its memory back to the arena when
+ * closed. The memory of the arena is kept until it is deleted.
+ * @version 1
+ * @date 2026-10-16
+ *
+ * @copyright Creative Commons.
+ *
+ */
+#ifndef COCA_ASTBUFFER_H
+#define COCA_ASTBUFFER_H
+
+#include <z3.h>
+
+/**
+ * @brief An arena of formulas.
+ */
+typedef struct AstArena_s *AstArena;
+
+/**
+ * @brief A growable array of formulas in an arena. Only the last buffer opened (and not closed) can be pushed into.
+ */
+typedef struct
+{
+    AstArena arena;         ///< The arena of the buffer.
+    struct AstChunk_s *chunk; ///< The block of the arena containing the buffer.
+    int start;              ///< The index in the block of the first formula of the buffer.
+    int size;               ///< The number of formulas in the buffer.
+} AstBuffer;
+
+/**
+ * @brief Creates an empty arena.
+ *
+ * @return AstArena The arena. Must be freed with deleteAstArena.
+ */
+AstArena createAstArena(void);
+
+/**
+ * @brief Frees an arena and all its buffers.
+ *
+ * @param arena An arena.
+ */
+void deleteAstArena(AstArena arena);
+
+/**
+ * @brief Opens an empty buffer after the buffers currently open in @p arena.
+ *
+ * @param arena An arena.
+ * @return AstBuffer The buffer. Must be closed with closeAstBuffer.
+ */
+AstBuffer openAstBuffer(AstArena arena);
+
+/**
+ * @brief Adds a formula at the end of a buffer, moving it to a larger block of the arena if needed.
+ *
+ * @param buffer A buffer.
+ * @param ast A formula.
+ * @pre @p buffer is the last buffer opened in its arena that is not closed.
+ */
+void pushAst(AstBuffer *buffer, Z3_ast ast);
+
+/**
+ * @brief Returns the formulas of a buffer. The array is valid until the next push into the buffer or its closure.
+ *
+ * @param buffer A buffer.
+ * @return Z3_ast* The formulas of @p buffer, in order of addition.
+ */
+Z3_ast *getAsts(const AstBuffer *buffer);
+
+/**
+ * @brief Closes a buffer and gives its memory back to the arena.
+ *
+ * @param buffer A buffer.
+ * @pre @p buffer is the last buffer opened in its arena that is not closed.
+ */
+void closeAstBuffer(AstBuffer *buffer);
+
+#endif
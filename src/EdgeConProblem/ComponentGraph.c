@@ -0,0 +1,255 @@
+#include "ComponentGraph.h"
+#include <stdlib.h>
+
+struct ComponentGraph_s
+{
+    int numComponents;     ///< The number of nodes.
+    int numEdges;          ///< The number of edges.
+    int *edgeNodes;        ///< The nodes of the original graph linked by each edge (2 per edge, the smaller first).
+    int *edgeComponents;   ///< The components linked by each edge (2 per edge, in the order of @p edgeNodes).
+    int *adjacentOffsets;  ///< The components adjacent to component j are adjacentComponents[adjacentOffsets[j]] to adjacentComponents[adjacentOffsets[j+1]-1]. Size numComponents+1.
+    int *adjacentComponents; ///< The adjacent components of each component, in increasing order.
+    int *pairOffsets;      ///< The edges between component j and adjacentComponents[a] are incidentEdges[pairOffsets[a]] to incidentEdges[pairOffsets[a+1]-1]. Size number of adjacencies + 1.
+    int *incidentEdges;    ///< The incident edges of each component, grouped by adjacent component. Each edge appears twice, once for each of its ends.
+};
+
+/**
+ * @brief An edge seen from one of its ends, used to sort the incident edges.
+ */
+typedef struct
+{
+    int component; ///< The end the edge is seen from.
+    int adjacent;  ///< The other end.
+    int edge;      ///< The edge.
+} IncidentEdge;
+
+static int compareIncidentEdges(const void *a, const void *b)
+{
+    const IncidentEdge *e1 = a, *e2 = b;
+    if (e1->component != e2->component)
+        return e1->component - e2->component;
+    if (e1->adjacent != e2->adjacent)
+        return e1->adjacent - e2->adjacent;
+    return e1->edge - e2->edge;
+}
+
+/**
+ * @brief Builds the adjacency of @p cg (offsets, adjacent components and incident edges) from its edges.
+ *
+ * @param cg A ComponentGraph whose edges are set.
+ */
+static void computeAdjacency(ComponentGraph cg)
+{
+    IncidentEdge *incident = (IncidentEdge *)malloc((2 * cg->numEdges + 1) * sizeof(IncidentEdge));
+    for (int e = 0; e < cg->numEdges; e++)
+    {
+        incident[2 * e] = (IncidentEdge){cg->edgeComponents[2 * e], cg->edgeComponents[2 * e + 1], e};
+        incident[2 * e + 1] = (IncidentEdge){cg->edgeComponents[2 * e + 1], cg->edgeComponents[2 * e], e};
+    }
+    qsort(incident, 2 * cg->numEdges, sizeof(IncidentEdge), compareIncidentEdges);
+
+    cg->incidentEdges = (int *)malloc((2 * cg->numEdges + 1) * sizeof(int));
+    cg->adjacentComponents = (int *)malloc((2 * cg->numEdges + 1) * sizeof(int));
+    cg->pairOffsets = (int *)malloc((2 * cg->numEdges + 1) * sizeof(int));
+    cg->adjacentOffsets = (int *)malloc((cg->numComponents + 1) * sizeof(int));
+
+    int numPairs = 0;
+    int i = 0;
+    for (int j = 0; j < cg->numComponents; j++)
+    {
+        cg->adjacentOffsets[j] = numPairs;
+        while (i < 2 * cg->numEdges && incident[i].component == j)
+        {
+            if (i == 0 || incident[i - 1].component != j || incident[i - 1].adjacent != incident[i].adjacent)
+            {
+                cg->adjacentComponents[numPairs] = incident[i].adjacent;
+                cg->pairOffsets[numPairs++] = i;
+            }
+            cg->incidentEdges[i] = incident[i].edge;
+            i++;
+        }
+    }
+    cg->adjacentOffsets[cg->numComponents] = numPairs;
+    cg->pairOffsets[numPairs] = 2 * cg->numEdges;
+
+    free(incident);
+}
+
+ComponentGraph initializeComponentGraph(const EdgeConGraph graph)
+{
+    Graph g = getGraph(graph);
+    ComponentGraph cg = (ComponentGraph)malloc(sizeof(*cg));
+    cg->numComponents = getNumComponents(graph);
+
+    cg->numEdges = 0;
+    for (int u = 0; u < orderG(g); u++)
+    {
+        int *neighbours = getNeighbours(g, u);
+        for (int k = 0; k < degreeG(g, u); k++)
+        {
+            int v = neighbours[k];
+            if (u < v && isEdgeHeterogeneous(graph, u, v) && !areInSameComponent(graph, u, v))
+                cg->numEdges++;
+        }
+    }
+
+    cg->edgeNodes = (int *)malloc((2 * cg->numEdges + 1) * sizeof(int));
+    cg->edgeComponents = (int *)malloc((2 * cg->numEdges + 1) * sizeof(int));
+    int e = 0;
+    for (int u = 0; u < orderG(g); u++)
+    {
+        int *neighbours = getNeighbours(g, u);
+        for (int k = 0; k < degreeG(g, u); k++)
+        {
+            int v = neighbours[k];
+            if (u < v && isEdgeHeterogeneous(graph, u, v) && !areInSameComponent(graph, u, v))
+            {
+                cg->edgeNodes[2 * e] = u;
+                cg->edgeNodes[2 * e + 1] = v;
+                cg->edgeComponents[2 * e] = getComponentOfNode(graph, u);
+                cg->edgeComponents[2 * e + 1] = getComponentOfNode(graph, v);
+                e++;
+            }
+        }
+    }
+
+    computeAdjacency(cg);
+    return cg;
+}
+
+void deleteComponentGraph(ComponentGraph cg)
+{
+    free(cg->edgeNodes);
+    free(cg->edgeComponents);
+    free(cg->adjacentOffsets);
+    free(cg->adjacentComponents);
+    free(cg->pairOffsets);
+    free(cg->incidentEdges);
+    free(cg);
+}
+
+int orderCG(const ComponentGraph cg)
+{
+    return cg->numComponents;
+}
+
+int sizeCG(const ComponentGraph cg)
+{
+    return cg->numEdges;
+}
+
+void getEdgeNodes(const ComponentGraph cg, int edge, int *node1, int *node2)
+{
+    *node1 = cg->edgeNodes[2 * edge];
+    *node2 = cg->edgeNodes[2 * edge + 1];
+}
+
+void getEdgeComponents(const ComponentGraph cg, int edge, int *component1, int *component2)
+{
+    *component1 = cg->edgeComponents[2 * edge];
+    *component2 = cg->edgeComponents[2 * edge + 1];
+}
+
+int getEdgesOfComponent(const ComponentGraph cg, int component, const int **edges)
+{
+    int first = cg->pairOffsets[cg->adjacentOffsets[component]];
+    int last = cg->pairOffsets[cg->adjacentOffsets[component + 1]];
+    *edges = cg->incidentEdges + first;
+    return last - first;
+}
+
+int getEdgesBetweenComponents(const ComponentGraph cg, int component1, int component2, const int **edges)
+{
+    int low = cg->adjacentOffsets[component1];
+    int high = cg->adjacentOffsets[component1 + 1] - 1;
+    while (low <= high)
+    {
+        int middle = (low + high) / 2;
+        if (cg->adjacentComponents[middle] == component2)
+        {
+            *edges = cg->incidentEdges + cg->pairOffsets[middle];
+            return cg->pairOffsets[middle + 1] - cg->pairOffsets[middle];
+        }
+        if (cg->adjacentComponents[middle] < component2)
+            low = middle + 1;
+        else
+            high = middle - 1;
+    }
+    *edges = NULL;
+    return 0;
+}
+
+/**
+ * @brief Breadth-first search in a forest of a ComponentGraph.
+ *
+ * @param cg A ComponentGraph.
+ * @param forestEdges The edges of the forest.
+ * @param firstSlot The first incident slot of each component, slot s standing for an end of forestEdges[s / 2].
+ * @param nextSlot The next incident slot of each slot.
+ * @param source A component.
+ * @param distance Will contain the distance from @p source of each component of its tree, which must be -1 before
+ *        (the other components are untouched).
+ * @param queue Scratch array of size orderCG(@p cg).
+ * @return int The component of the tree of @p source farthest from it.
+ */
+static int farthestComponent(const ComponentGraph cg, const int *forestEdges, const int *firstSlot,
+                             const int *nextSlot, int source, int *distance, int *queue)
+{
+    int front = 0, rear = 0;
+    int farthest = source;
+
+    distance[source] = 0;
+    queue[rear++] = source;
+    while (front < rear)
+    {
+        int x = queue[front++];
+        if (distance[x] > distance[farthest])
+            farthest = x;
+        for (int slot = firstSlot[x]; slot != -1; slot = nextSlot[slot])
+        {
+            // The other end of the edge is in the other slot of the pair.
+            int y = cg->edgeComponents[2 * forestEdges[slot / 2] + 1 - slot % 2];
+            if (distance[y] == -1)
+            {
+                distance[y] = distance[x] + 1;
+                queue[rear++] = y;
+            }
+        }
+    }
+    return farthest;
+}
+
+int sumOfTreeDiameters(const ComponentGraph cg, const int *forestEdges, int numEdges)
+{
+    int firstSlot[cg->numComponents];
+    int nextSlot[2 * numEdges + 1];
+    int distance[cg->numComponents];
+    int reached[cg->numComponents];
+    int queue[cg->numComponents];
+    int sum = 0;
+
+    for (int c = 0; c < cg->numComponents; c++)
+    {
+        firstSlot[c] = -1;
+        reached[c] = -1;
+        distance[c] = -1;
+    }
+    for (int slot = 0; slot < 2 * numEdges; slot++)
+    {
+        int c = cg->edgeComponents[2 * forestEdges[slot / 2] + slot % 2];
+        nextSlot[slot] = firstSlot[c];
+        firstSlot[c] = slot;
+    }
+
+    // The first search from any component of a tree ends on an end of a diameter of this tree, the second one
+    // starts there. The trees are disjoint, so each array is only written once per component.
+    for (int c = 0; c < cg->numComponents; c++)
+    {
+        if (reached[c] == -1)
+        {
+            int end = farthestComponent(cg, forestEdges, firstSlot, nextSlot, c, reached, queue);
+            sum += distance[farthestComponent(cg, forestEdges, firstSlot, nextSlot, end, distance, queue)];
+        }
+    }
+    return sum;
+}
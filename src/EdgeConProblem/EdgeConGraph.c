@@ -1,4 +1,6 @@
 #include "EdgeConGraph.h"
+#include "Bitset.h"
+#include "UnionFind.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <sys/types.h>
@@ -7,59 +9,81 @@
 
 struct EdgeConGraph_s
 {
-    Graph graph;                  ///< The graph.
-    bool *heterogeneousEdges;     ///< The edges that are heterogeneous (not taking into account the translators).
-    bool **homogeneousComponents; ///< The homogeneous connected components (taking into account the translators). Each member is an array of size @p graph.numNodes that sets all nodes in a connected component to true and other to false. There are @p numComponents such arrays, and a node is true in exactly one array.
-    bool *translators;            ///< The translator edges.
-    int numComponents;            ///< The number of homogeneous components.
+    Graph graph;                    ///< The graph.
+    int numWords;                   ///< The number of words of a row of the bit matrices below (see Bitset.h).
+    uint64_t *heterogeneousEdges;    ///< The edges that are heterogeneous (not taking into account the translators), as a bit matrix.
+    int *componentOf;               ///< The homogeneous connected component (taking into account the translators) of each node, numbered from 0 to @p numComponents - 1 in the order of their smallest node.
+    UnionFind components;           ///< The partition of the nodes used to compute @p componentOf.
+    uint64_t *translators;           ///< The translator edges, as a bit matrix.
+    int *translatorList;            ///< The translator edges as pairs of nodes, so that they can be removed without clearing the whole matrix.
+    int numTranslators;             ///< The number of pairs in @p translatorList.
+    bool incremental;               ///< True if @p components is updated by addTranslator and removeTranslator (see setIncrementalComponents).
+    int *translatorCheckpoints;     ///< In incremental mode, the number of merges recorded in @p components before merging each translator of @p translatorList.
+    int numComponents;              ///< The number of homogeneous components.
 };
 
 EdgeConGraph initializeGraph(Graph graph)
 {
     EdgeConGraph result = (EdgeConGraph)malloc(sizeof(*result));
     result->graph = graph;
-    result->heterogeneousEdges = (bool *)malloc(orderG(graph) * orderG(graph) * sizeof(bool));
-    result->homogeneousComponents = (bool **)malloc(orderG(graph) * sizeof(bool *));
-    for (int i = 0; i < orderG(graph); i++)
-        result->homogeneousComponents[i] = (bool *)malloc(orderG(graph) * sizeof(bool));
-    result->translators = (bool *)malloc(orderG(graph) * orderG(graph) * sizeof(bool));
+    result->numWords = numWordsOfBitset(orderG(graph));
+    result->heterogeneousEdges = createBitMatrix(orderG(graph), orderG(graph));
+    result->componentOf = (int *)malloc(orderG(graph) * sizeof(int));
+    result->components = createUnionFind(orderG(graph));
+    result->translators = createBitMatrix(orderG(graph), orderG(graph));
+    result->translatorList = (int *)malloc((2 * graph.neighbourOffsets[orderG(graph)] + 1) * sizeof(int));
+    result->numTranslators = 0;
+    result->translatorCheckpoints = (int *)malloc((graph.neighbourOffsets[orderG(graph)] + 1) * sizeof(int));
+    result->incremental = false;
     result->numComponents = 0;
 
     for (int i = 0; i < orderG(graph); i++)
     {
-        for (int j = 0; j < orderG(graph); j++)
+        int *neighbours = getNeighbours(graph, i);
+        for (int k = 0; k < degreeG(graph, i); k++)
         {
-            result->heterogeneousEdges[i * orderG(graph) + j] = isEdge(graph, i, j) && (getColor(graph, i) != getColor(graph, j));
+            int j = neighbours[k];
+            if (getColor(graph, i) != getColor(graph, j))
+                setBit(getBitsetRow(result->heterogeneousEdges, result->numWords, i), j);
         }
     }
 
-    for (int i = 0; i < orderG(graph) * orderG(graph); i++)
-        result->translators[i] = false;
-
     computesHomogeneousComponents(result);
 
     return result;
 }
 
+static void mergeTranslator(EdgeConGraph graph, int index);
+
 Graph getGraph(const EdgeConGraph graph) { return graph->graph; }
 
 void resetTranslator(EdgeConGraph graph)
 {
     graph->numComponents = 0;
 
-    for (int i = 0; i < orderG(graph->graph) * orderG(graph->graph); i++)
-        graph->translators[i] = false;
+    if (graph->incremental)
+        undoMerges(graph->components, 0);
+
+    for (int i = 0; i < graph->numTranslators; i++)
+    {
+        int node1 = graph->translatorList[2 * i];
+        int node2 = graph->translatorList[2 * i + 1];
+        clearBit(getBitsetRow(graph->translators, graph->numWords, node1), node2);
+        clearBit(getBitsetRow(graph->translators, graph->numWords, node2), node1);
+    }
+    graph->numTranslators = 0;
 
     computesHomogeneousComponents(graph);
 }
 
 void deleteEdgeConGraph(EdgeConGraph graph)
 {
-    free(graph->heterogeneousEdges);
-    free(graph->translators);
-    for (int i = 0; i < orderG(graph->graph); i++)
-        free(graph->homogeneousComponents[i]);
-    free(graph->homogeneousComponents);
+    deleteBitset(graph->heterogeneousEdges);
+    deleteBitset(graph->translators);
+    free(graph->componentOf);
+    deleteUnionFind(graph->components);
+    free(graph->translatorList);
+    free(graph->translatorCheckpoints);
     free(graph);
 }
 
@@ -67,8 +91,8 @@ void setHeterogeneousEdge(EdgeConGraph graph, int node1, int node2)
 {
     if (isEdge(graph->graph, node1, node2))
     {
-        graph->heterogeneousEdges[node1 * orderG(graph->graph) + node2] = true;
-        graph->heterogeneousEdges[node2 * orderG(graph->graph) + node1] = true;
+        setBit(getBitsetRow(graph->heterogeneousEdges, graph->numWords, node1), node2);
+        setBit(getBitsetRow(graph->heterogeneousEdges, graph->numWords, node2), node1);
     }
 }
 
@@ -76,103 +100,182 @@ void SetHomogeneousEdge(EdgeConGraph graph, int node1, int node2)
 {
     if (isEdge(graph->graph, node1, node2))
     {
-        graph->heterogeneousEdges[node1 * orderG(graph->graph) + node2] = false;
-        graph->heterogeneousEdges[node2 * orderG(graph->graph) + node1] = false;
+        clearBit(getBitsetRow(graph->heterogeneousEdges, graph->numWords, node1), node2);
+        clearBit(getBitsetRow(graph->heterogeneousEdges, graph->numWords, node2), node1);
     }
 }
 
 bool isEdgeHomogeneous(const EdgeConGraph graph, int node1, int node2)
 {
-    return (isEdge(graph->graph, node1, node2) && !graph->heterogeneousEdges[node1 * orderG(graph->graph) + node2]);
+    return (isEdge(graph->graph, node1, node2) && !testBit(getBitsetRow(graph->heterogeneousEdges, graph->numWords, node1), node2));
 }
 
 bool isEdgeHeterogeneous(const EdgeConGraph graph, int node1, int node2)
 {
-    return (isEdge(graph->graph, node1, node2) && graph->heterogeneousEdges[node1 * orderG(graph->graph) + node2]);
+    return (isEdge(graph->graph, node1, node2) && testBit(getBitsetRow(graph->heterogeneousEdges, graph->numWords, node1), node2));
 }
 
 int getNumHeteregeneousEdges(const EdgeConGraph graph)
 {
     int numNodes = orderG(graph->graph);
     int result = 0;
+    // Heterogeneous bits are only ever set on edges, so counting the upper triangle of the matrix is enough.
     for (int u = 0; u < numNodes; u++)
-    {
-        for (int v = u + 1; v < numNodes; v++)
-        {
-            if (isEdgeHeterogeneous(graph, u, v))
-                result++;
-        }
-    }
+        result += countBitsFrom(getBitsetRow(graph->heterogeneousEdges, graph->numWords, u), graph->numWords, u + 1);
     return result;
 }
 
 void addTranslator(EdgeConGraph graph, int node1, int node2)
 {
-    graph->translators[node1 * orderG(graph->graph) + node2] = true;
-    graph->translators[node2 * orderG(graph->graph) + node1] = true;
+    if (isTranslator(graph, node1, node2))
+        return;
+    setBit(getBitsetRow(graph->translators, graph->numWords, node1), node2);
+    setBit(getBitsetRow(graph->translators, graph->numWords, node2), node1);
+    graph->translatorList[2 * graph->numTranslators] = node1;
+    graph->translatorList[2 * graph->numTranslators + 1] = node2;
+    graph->numTranslators++;
+
+    if (graph->incremental)
+    {
+        mergeTranslator(graph, graph->numTranslators - 1);
+        graph->numComponents = getNumSets(graph->components);
+    }
 }
 
 void removeTranslator(EdgeConGraph graph, int node1, int node2)
 {
-    graph->translators[node1 * orderG(graph->graph) + node2] = false;
-    graph->translators[node2 * orderG(graph->graph) + node1] = false;
+    if (!isTranslator(graph, node1, node2))
+        return;
+    clearBit(getBitsetRow(graph->translators, graph->numWords, node1), node2);
+    clearBit(getBitsetRow(graph->translators, graph->numWords, node2), node1);
+    int index = graph->numTranslators - 1;
+    while (!((graph->translatorList[2 * index] == node1 && graph->translatorList[2 * index + 1] == node2) ||
+             (graph->translatorList[2 * index] == node2 && graph->translatorList[2 * index + 1] == node1)))
+        index--;
+
+    // The list keeps the order of addition, which the incremental mode relies on.
+    graph->numTranslators--;
+    memmove(graph->translatorList + 2 * index, graph->translatorList + 2 * index + 2,
+            2 * (graph->numTranslators - index) * sizeof(int));
+
+    if (graph->incremental)
+    {
+        // Undo the merges of the removed translator and of the ones added after it, then merge these again.
+        undoMerges(graph->components, graph->translatorCheckpoints[index]);
+        for (int i = index; i < graph->numTranslators; i++)
+            mergeTranslator(graph, i);
+        graph->numComponents = getNumSets(graph->components);
+    }
 }
 
 bool isTranslator(const EdgeConGraph graph, int node1, int node2)
 {
-    return graph->translators[node1 * orderG(graph->graph) + node2];
+    return testBit(getBitsetRow(graph->translators, graph->numWords, node1), node2);
 }
 
-void computesComponent(EdgeConGraph graph, int node, int component)
+/**
+ * @brief Merges in @p graph->components the endpoints of every homogeneous edge.
+ *
+ * @param graph An EdgeConGraph.
+ * @param withTranslators If true, also merges the endpoints of every translator.
+ */
+static void mergeHomogeneousEdges(EdgeConGraph graph, bool withTranslators)
 {
-    if (graph->homogeneousComponents[component][node])
-        return;
-    graph->homogeneousComponents[component][node] = true;
-    for (int i = 0; i < orderG(graph->graph); i++)
+    for (int u = 0; u < orderG(graph->graph); u++)
     {
-        if (isEdgeHomogeneous(graph, node, i) || isTranslator(graph, node, i))
-            computesComponent(graph, i, component);
+        int *neighbours = getNeighbours(graph->graph, u);
+        for (int k = 0; k < degreeG(graph->graph, u); k++)
+        {
+            int v = neighbours[k];
+            if (isEdgeHomogeneous(graph, u, v) || (withTranslators && isTranslator(graph, u, v)))
+                mergeSets(graph->components, u, v);
+        }
     }
-    return;
 }
 
-void computesHomogeneousComponents(EdgeConGraph graph)
+/**
+ * @brief Merges in @p graph->components the endpoints of the translator at position @p index of the translator
+ * list, remembering how many merges were recorded before so that it can be undone.
+ *
+ * @param graph An EdgeConGraph in incremental mode.
+ * @param index A position in the translator list.
+ */
+static void mergeTranslator(EdgeConGraph graph, int index)
+{
+    graph->translatorCheckpoints[index] = getNumRecordedMerges(graph->components);
+    mergeSets(graph->components, graph->translatorList[2 * index], graph->translatorList[2 * index + 1]);
+}
+
+/**
+ * @brief Numbers the sets of @p graph->components from 0, in the order of their smallest node, and stores the
+ * result in @p graph->componentOf and @p graph->numComponents.
+ *
+ * @param graph An EdgeConGraph.
+ */
+static void numberComponents(EdgeConGraph graph)
 {
+    int numNodes = orderG(graph->graph);
+    int idOfRepresentative[numNodes];
+
+    for (int u = 0; u < numNodes; u++)
+        idOfRepresentative[u] = -1;
     graph->numComponents = 0;
-    int currentNode = 0;
-    while (currentNode < orderG(graph->graph))
+    for (int u = 0; u < numNodes; u++)
     {
-        for (int i = 0; i < orderG(graph->graph); i++)
-            graph->homogeneousComponents[graph->numComponents][i] = false;
-        computesComponent(graph, currentNode, graph->numComponents);
-        bool acc = true;
-        while (currentNode < orderG(graph->graph) && acc)
-        {
-            acc = false;
-            for (int i = 0; i <= graph->numComponents; i++)
-            {
-                acc = acc || graph->homogeneousComponents[i][currentNode];
-            }
-            if (acc)
-                currentNode++;
-        }
-        (graph->numComponents)++;
+        int representative = findRepresentative(graph->components, u);
+        if (idOfRepresentative[representative] == -1)
+            idOfRepresentative[representative] = (graph->numComponents)++;
+        graph->componentOf[u] = idOfRepresentative[representative];
     }
 }
 
-bool areInSameComponent(const EdgeConGraph graph, int node1, int node2)
+void computesHomogeneousComponents(EdgeConGraph graph)
 {
-    bool result = false;
-    for (int i = 0; i < graph->numComponents; i++)
+    if (!graph->incremental)
     {
-        result = result || (graph->homogeneousComponents[i][node1] && graph->homogeneousComponents[i][node2]);
+        resetUnionFind(graph->components);
+        mergeHomogeneousEdges(graph, true);
     }
-    return result;
+    numberComponents(graph);
+}
+
+void setIncrementalComponents(EdgeConGraph graph, bool incremental)
+{
+    if (graph->incremental == incremental)
+        return;
+    graph->incremental = incremental;
+
+    if (incremental)
+    {
+        // Translators are replayed on top of the homogeneous components, so that each of them can be undone.
+        stopRecordingMerges(graph->components);
+        resetUnionFind(graph->components);
+        mergeHomogeneousEdges(graph, false);
+        startRecordingMerges(graph->components);
+        for (int i = 0; i < graph->numTranslators; i++)
+            mergeTranslator(graph, i);
+    }
+    else
+        stopRecordingMerges(graph->components);
+
+    numberComponents(graph);
+}
+
+bool areInSameComponent(const EdgeConGraph graph, int node1, int node2)
+{
+    if (graph->incremental)
+        return findRepresentative(graph->components, node1) == findRepresentative(graph->components, node2);
+    return graph->componentOf[node1] == graph->componentOf[node2];
 }
 
 bool isNodeInComponent(const EdgeConGraph graph, int node, int component)
 {
-    return graph->homogeneousComponents[component][node];
+    return graph->componentOf[node] == component;
+}
+
+int getComponentOfNode(const EdgeConGraph graph, int node)
+{
+    return graph->componentOf[node];
 }
 
 int getNumComponents(const EdgeConGraph graph)
@@ -187,9 +290,11 @@ void printTranslator(const EdgeConGraph graph)
     printf("Translator edges: ");
     for (int i = 0; i < orderG(graph->graph); i++)
     {
-        for (int j = i + 1; j < orderG(graph->graph); j++)
+        int *neighbours = getNeighbours(graph->graph, i);
+        for (int k = 0; k < degreeG(graph->graph, i); k++)
         {
-            if (graph->translators[i * orderG(graph->graph) + j])
+            int j = neighbours[k];
+            if (i < j && isTranslator(graph, i, j))
                 printf("%s(%d)-%s(%d), ", getNodeName(graph->graph, i), i, getNodeName(graph->graph, j), j);
         }
     }
@@ -234,9 +339,11 @@ void createDotOfEdgeConGraph(const EdgeConGraph graph, char *name)
 
     for (int node = 0; node < orderG(graph->graph); node++)
     {
-        for (int node2 = 0; node2 < node; node2++)
+        int *neighbours = getNeighbours(graph->graph, node);
+        for (int k = 0; k < degreeG(graph->graph, node); k++)
         {
-            if (isEdge(graph->graph, node, node2))
+            int node2 = neighbours[k];
+            if (node2 < node)
             {
                 fprintf(file, "%s -- %s", getNodeName(graph->graph, node), getNodeName(graph->graph, node2));
                 if (isTranslator(graph, node, node2))
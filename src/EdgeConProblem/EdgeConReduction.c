@@ -6,48 +6,67 @@
 #include <assert.h>
 
 #include "EdgeConReduction.h"
+#include "AstBuffer.h"
+#include "Bitset.h"
 #include "Z3Tools.h"
 
 #define MAX(X, Y) X > Y ? X : Y
 
+/** The size of the name of a variable: the text of x_[(u,v),i] and three ints of up to 11 characters. */
+#define VAR_NAME_SIZE (8 + 3 * 11 + 1)
+
 /** Macros used to improve the readability of formula construction. */
 
-#define NOT(X) Z3_mk_not(ctx->z3_ctx, X)
-#define AND(n) Z3_mk_and(ctx->z3_ctx, n, (Z3_ast[n]) {
+#define NOT(X) Z3_mk_not(z3_ctx, X)
+#define AND(n) Z3_mk_and(z3_ctx, n, (Z3_ast[n]) {
 #define EAND })
-#define OR(n) Z3_mk_or(ctx->z3_ctx, n, (Z3_ast[n]) {
+#define OR(n) Z3_mk_or(z3_ctx, n, (Z3_ast[n]) {
 #define EOR })
 
-#define X_(n1, n2, i) getVariableIsIthTranslator(ctx->z3_ctx, n1, n2, i)
-#define P_(j1, j2) getVariableParent(ctx->z3_ctx, j1, j2)
-#define L_(j, h) getVariableLevelInSpanningTree(ctx->z3_ctx, h, j)
+#define X_(e, i) (1 + (int)(e) * (int)ctx->N + (i))
+#define P_(j1, j2) (ctx->firstP + (j1) * ctx->C_H + (j2))
+#define L_(j, h) (ctx->firstL + (j) * ctx->C_H + (h))
 
 #define FORALL_TRANSLATOR(I) \
-    for (int I = 0; I < ctx->N; I++) {
+    for (int I = 0; I < (int)ctx->N; I++) {
 
 #define EFI }
 
-#define FORALL_EDGE(N1, N2) \
-        for (int N1 = 0; N1 < ctx->n; ++N1) { \
-            for (int N2 = N1 + 1; N2 < ctx->n; ++N2) { \
-                if (isEdge(ctx->G, N1, N2)) {
+#define FORALL_EDGE(E) \
+    for (unsigned int E = 0; E < ctx->m; E++) {
 
-#define EFE }}}
+#define EFE }
 
 #define FORALL_COMPONENT(J) \
     for (int J = 0; J < ctx->C_H; J++) {
 
-#define FORALL_COMPONENT_EXCEPT_ROOT(J) \
-    for (int J = 1; J < ctx->C_H; J++) {
-
 #define EFC }
 
 #define FORALL_LEVEL(n) \
-    for (int n = 0; n < ctx->N; n++) {
+    for (int n = 0; n < ctx->C_H; n++) {
 
 #define EFL }
 
 
+/** The encoding of the "at most one" constraints, see setAtMostOneEncoding. */
+static AtMostOneEncoding amoEncoding = AMO_PAIRWISE;
+
+/** If the symmetry breaking constraints are added, see setSymmetryBreaking. */
+static bool symmetryBreaking = false;
+
+/**
+ * Receives the clauses of the formula, one at a time. A literal is the number
+ * of a variable (starting from 1) or its opposite for the negation, as in
+ * DIMACS.
+ */
+typedef struct ClauseSink_s ClauseSink;
+struct ClauseSink_s {
+    /** Adds the disjunction of the @p numLiterals literals. */
+    void (*addClause)(ClauseSink *sink, const int *literals, int numLiterals);
+    /** Adds "at most one of the literals is true", NULL if the sink only takes clauses. */
+    void (*addAtMostOne)(ClauseSink *sink, const int *literals, int numLiterals);
+};
+
 /** Stores all needed data used to build formulas. */
 typedef struct {
     unsigned int n;     ///< The numbers of vertex.
@@ -57,116 +76,155 @@ typedef struct {
     int k;              ///< The maximum cost of a simple and valid path between two vertex.
     Graph G;            ///< The graph.
     EdgeConGraph graph; ///< The EdgeConGraph.
-    Z3_context z3_ctx;  ///< The current Z3 context.
+    int *edgeNodes;     ///< The edges (u, v), u < v, numbered by u then v: edge e is (edgeNodes[2e], edgeNodes[2e + 1]).
+    int *pairOffsets;   ///< The edges from parent j2 to child j1 are pairEdges[pairOffsets[j1 * C_H + j2]] to pairEdges[pairOffsets[j1 * C_H + j2 + 1] - 1]. Size C_H * C_H + 1.
+    int *pairEdges;     ///< The edges (u, v), u < v, between two components, grouped by (component of v, component of u).
+    int firstP;         ///< The number of the variable p_[0,0], see P_.
+    int firstL;         ///< The number of the variable l_[0,0], see L_.
+    int numVars;        ///< The number of variables used so far, auxiliary ones included.
+    int *literals;      ///< The literals of the clause being emitted.
+    int numLiterals;    ///< The number of literals of the clause being emitted.
+    int maxLiterals;    ///< The size of literals.
+    int *amoVars;       ///< The variables of an "at most one" constraint being emitted.
+    ClauseSink *sink;   ///< Where the clauses are emitted.
 } g_context_s;
 
+/** A sink building the Z3 formula of the clauses. */
+typedef struct {
+    ClauseSink sink;    ///< The callbacks, must be first.
+    Z3_context z3_ctx;  ///< The current Z3 context.
+    Z3_ast *vars;       ///< vars[v] is the variable numbered v (vars[0] is unused).
+    int numVars;        ///< The number of variables created.
+    int maxVars;        ///< The size of vars minus one.
+    AstArena arena;     ///< The memory of the clauses and of their literals.
+    AstBuffer clauses;  ///< The clauses added since the last take_z3_formula.
+} Z3Sink;
+
+/** A sink writing the clauses in DIMACS format. */
+typedef struct {
+    ClauseSink sink;    ///< The callbacks, must be first.
+    FILE *file;         ///< The output of the clauses.
+    long numClauses;    ///< The number of clauses added.
+} DimacsSink;
+
+/** A sink writing the clauses as SMT-LIB2 assertions. */
+typedef struct {
+    ClauseSink sink;            ///< The callbacks, must be first.
+    FILE *file;                 ///< The output.
+    const g_context_s *ctx;     ///< The reduction context, to name the variables.
+    int numDeclared;            ///< The variables 1 to numDeclared are declared.
+} SmtLibSink;
+
 
 /**
- * Builds the formula ensuring the constraint:
+ * Emits the formula ensuring the constraint:
  *
  *   "Each translator can only be associated with at most one edge"
  *
  * @param ctx is the current reduction context.
- *
- * @return the Z3 ast corresponding to the formula.
  */
-static Z3_ast build_phi_2_1(const g_context_s *ctx);
+static void emit_phi_2_1(g_context_s *ctx);
 
 /**
- * Builds the formula ensuring the constraint:
+ * Emits the formula ensuring the constraint:
  *
  *   "Each edge can only receive at most one translator"
  *
  * @param ctx is the current reduction context.
- *
- * @return the Z3 ast corresponding to the formula.
  */
-static Z3_ast build_phi_2_2(const g_context_s *ctx);
+static void emit_phi_2_2(g_context_s *ctx);
 
 /**
- * Builds the conjunction of the formulas phi_2_1 and phi_2_2
+ * Emits the conjunction of the formulas phi_2_1 and phi_2_2
  *
  * @param ctx is the current reduction context.
- *
- * @return the Z3 ast corresponding to the formula.
  */
-static Z3_ast build_phi_2(const g_context_s *ctx);
+static void emit_phi_2(g_context_s *ctx);
 
 /**
- * Builds the formula ensuring the constraint:
+ * Emits the formula ensuring the constraint:
  *
- *   "Each homogeneous components own at least one parent, except the root"
+ *   "Each homogeneous components own at least one parent, except the root
+ *    (the component at level 0)"
  *
  * @param ctx is the current reduction context.
- *
- * @return the Z3 ast corresponding to the formula.
  */
-static Z3_ast build_phi_3_1(const g_context_s *ctx);
+static void emit_phi_3_1(g_context_s *ctx);
 
 /**
- * Builds the formula ensuring the constraint:
+ * Emits the formula ensuring the constraint:
  *
- *   "Each homogeneous components own at most one parent, except the root"
+ *   "Each homogeneous components own at most one parent"
  *
  * @param ctx is the current reduction context.
- *
- * @return the Z3 ast corresponding to the formula.
  */
-static Z3_ast build_phi_3_2(const g_context_s *ctx);
+static void emit_phi_3_2(g_context_s *ctx);
 
 /**
- * Builds the conjunction of the formulas phi_3_1 and phi_3_2
+ * Emits the formula ensuring the constraint:
+ *
+ *   "The root (the component at level 0) owns no parent"
  *
  * @param ctx is the current reduction context.
+ */
+static void emit_phi_3_3(g_context_s *ctx);
+
+/**
+ * Emits the conjunction of the formulas phi_3_1, phi_3_2 and phi_3_3
  *
- * @return the Z3 ast corresponding to the formula.
+ * @param ctx is the current reduction context.
  */
-static Z3_ast build_phi_3(const g_context_s *ctx);
+static void emit_phi_3(g_context_s *ctx);
 
 /**
- * Builds the formula ensuring the constraint:
+ * Emits the formula ensuring the constraint:
  *
  *   "Each homogeneous components own at least one level"
  *
  * @param ctx is the current reduction context.
- *
- * @return the Z3 ast corresponding to the formula.
  */
-static Z3_ast build_phi_4_1(const g_context_s *ctx);
+static void emit_phi_4_1(g_context_s *ctx);
 
 /**
- * Builds the formula ensuring the constraint:
+ * Emits the formula ensuring the constraint:
  *
  *   "Each homogeneous components own at most one level"
  *
  * @param ctx is the current reduction context.
- *
- * @return the Z3 ast corresponding to the formula.
  */
-static Z3_ast build_phi_4_2(const g_context_s *ctx);
+static void emit_phi_4_2(g_context_s *ctx);
 
 /**
- * Builds the conjunction of the formulas phi_4_1 and phi_4_2
+ * Emits the formula ensuring the constraint:
+ *
+ *   "At most one homogeneous component is at level 0"
+ *
+ * Any component can be the root, so that the depth of the tree can reach its
+ * diameter.
  *
  * @param ctx is the current reduction context.
+ */
+static void emit_phi_4_3(g_context_s *ctx);
+
+/**
+ * Emits the conjunction of the formulas phi_4_1, phi_4_2 and phi_4_3
  *
- * @return the Z3 ast corresponding to the formula.
+ * @param ctx is the current reduction context.
  */
-static Z3_ast build_phi_4(const g_context_s *ctx);
+static void emit_phi_4(g_context_s *ctx);
 
 /**
- * Builds the formula ensuring the constraint:
+ * Emits the formula ensuring the constraint:
  *
  *   "The tree has a depth strictly greater than k."
  *
  * @param ctx is the current reduction context.
- *
- * @return the Z3 ast corresponding to the formula.
  */
-static Z3_ast build_phi_5(const g_context_s *ctx);
+static void emit_phi_5(g_context_s *ctx);
 
 /**
- * Builds the formula ensuring the constraint:
+ * Adds to the clause being emitted the literals of the formula ensuring the
+ * constraint:
  *
  *   "For two homogeneous components, exists an edge (u, v) between X_@p j1 and
  *    X_@p j2 and one of them have a translator."
@@ -174,107 +232,447 @@ static Z3_ast build_phi_5(const g_context_s *ctx);
  * @param ctx is the current reduction context.
  * @param j1 is the number of the first homogeneous component.
  * @param j2 is the number of the second homogeneous component.
- *
- * @return the Z3 ast corresponding to the formula.
  */
-static Z3_ast build_phi_6(const g_context_s *ctx, const int j1, const int j2);
+static void add_phi_6(g_context_s *ctx, const int j1, const int j2);
 
 /**
- * Builds the formula ensuring the constraint:
+ * Emits the formula ensuring the constraint:
  *
  *   "For two homogeneous components, if X_@p j1 is at level h then X_@p j2
  *    is at level h - 1."
  *
+ * Each clause is guarded by the literal @p guard.
+ *
  * @param ctx is the current reduction context.
+ * @param guard is a literal added to each clause.
  * @param j1 is the number of the first homogeneous component.
  * @param j2 is the number of the second homogeneous component.
- *
- * @return the Z3 ast corresponding to the formula.
  */
-static Z3_ast build_phi_7(const g_context_s *ctx, const int j1, const int j2);
+static void emit_phi_7(g_context_s *ctx, int guard, const int j1, const int j2);
 
 /**
- * Builds the formula ensuring the constraint:
+ * Emits the formula ensuring the constraint:
  *
  *   "For any two homogeneous components, if X_j1 is a parent of X_j2, then the
  *    conditions of phi_6 and phi_7 are satisfied."
  *
  * @param ctx is the current reduction context.
+ */
+static void emit_phi_8(g_context_s *ctx);
+
+/**
+ * Emits the symmetry breaking formula ensuring the constraint:
  *
- * @return the Z3 ast corresponding to the formula.
+ *   "If translator i + 1 is on edge e, translator i is on an edge smaller
+ *    than e."
+ *
+ * For each edge e and translator i, an auxiliary variable is only true if
+ * translator i is on an edge smaller than or equal to e.
+ *
+ * @param ctx is the current reduction context.
+ */
+static void emit_translator_order(g_context_s *ctx);
+
+/**
+ * Emits the formulas phi_2, phi_3, phi_4 and phi_8, that do not depend on
+ * the cost, and the symmetry breaking formulas if enabled.
+ *
+ * @param ctx is the current reduction context.
+ */
+static void emit_cost_independent_formulas(g_context_s *ctx);
+
+/**
+ * Emits the formula ensuring that at most one of @p vars is true, with the
+ * encoding chosen by setAtMostOneEncoding.
+ *
+ * @param ctx is the current reduction context.
+ * @param numVars is the number of variables.
+ * @param vars are the variables.
+ */
+static void emit_at_most_one(g_context_s *ctx, int numVars, const int *vars);
+
+/**
+ * Adds a literal to the clause being emitted.
+ *
+ * @param ctx is the current reduction context.
+ * @param literal is a literal.
+ */
+static void add_literal(g_context_s *ctx, int literal);
+
+/**
+ * Emits the clause made of the literals added since the previous one.
+ *
+ * @param ctx is the current reduction context.
+ */
+static void end_clause(g_context_s *ctx);
+
+/**
+ * Emits the clause (@p literal1 or @p literal2).
+ *
+ * @param ctx is the current reduction context.
+ * @param literal1 is a literal.
+ * @param literal2 is a literal.
  */
-static Z3_ast build_phi_8(const g_context_s *ctx);
+static void emit_binary_clause(g_context_s *ctx, int literal1, int literal2);
 
-static g_context_s* init_g_context(Z3_context z3_ctx, EdgeConGraph graph, int cost);
+/**
+ * Creates an auxiliary variable.
+ *
+ * @param ctx is the current reduction context.
+ *
+ * @return the number of the variable.
+ */
+static int new_variable(g_context_s *ctx);
 
 /**
- * Checks if the edge (@p n1, @p n2) is the @p i -th translator.
+ * Creates the reduction context and numbers the variables of the formula:
+ * the x_ variables first, then the p_ variables, the l_ variables and the
+ * auxiliary variables of the "at most one" encodings.
  *
- * @param ctx is the solver context.
- * @param model is the solver model.
  * @param graph is a EdgeConGraph.
- * @param n1 is the first node of the edge.
- * @param n2 is the second node of the edge.
- * @param i is number of the the translator.
- *
- * @return true if the edge (@p n1, @p n2) is the @p i -th translator of @p
- * graph, otherwise false.
- */
-static bool is_the_ith_translator(
-    const Z3_context ctx,
-    const Z3_model model,
-    const EdgeConGraph graph,
-    const int n1,
-    const int n2,
-    const int i
-);
+ * @param cost is the cost of the reduction.
+ *
+ * @return the reduction context, to be freed with delete_g_context.
+ */
+static g_context_s* init_g_context(EdgeConGraph graph, int cost);
+
+/**
+ * Frees a reduction context.
+ *
+ * @param ctx is a reduction context.
+ */
+static void delete_g_context(g_context_s *ctx);
+
+/**
+ * Numbers the edges of the graph and groups the edges between two
+ * components by pair of components (counting sort), so that each builder
+ * iterates exactly the edges it needs.
+ *
+ * @param ctx is a reduction context whose graph and components are set.
+ */
+static void index_edges(g_context_s *ctx);
+
+/**
+ * Creates a sink building the Z3 formula of the clauses emitted in @p ctx,
+ * and each variable of the formula. Each variable is created once here (or
+ * when an auxiliary variable is first used), the clauses only read it back.
+ *
+ * @param ctx is the reduction context whose sink it becomes.
+ * @param z3_ctx is the solver context.
+ *
+ * @return the sink, to be freed with delete_z3_sink.
+ */
+static Z3Sink *create_z3_sink(g_context_s *ctx, Z3_context z3_ctx);
+
+/**
+ * Frees a sink (the variables stay valid in the solver context).
+ *
+ * @param sink is a Z3 sink.
+ */
+static void delete_z3_sink(Z3Sink *sink);
+
+/**
+ * Builds the conjunction of the clauses added to @p sink since the previous
+ * call, and forgets them.
+ *
+ * @param sink is a Z3 sink.
+ *
+ * @return the Z3 ast corresponding to the formula.
+ */
+static Z3_ast take_z3_formula(Z3Sink *sink);
 
 Z3_ast getVariableIsIthTranslator(Z3_context ctx, int node1, int node2, int number) {
-    char name[40];
+    char name[VAR_NAME_SIZE];
 
     if (node1 < node2) {
-        snprintf(name, 40, "x_[(%d,%d),%d]", node1, node2, number);
+        snprintf(name, VAR_NAME_SIZE, "x_[(%d,%d),%d]", node1, node2, number);
     }
     else {
-        snprintf(name, 40, "x_[(%d,%d),%d]", node2, node1, number);
+        snprintf(name, VAR_NAME_SIZE, "x_[(%d,%d),%d]", node2, node1, number);
     }
 
     return mk_bool_var(ctx, name);
 }
 
 Z3_ast getVariableParent(Z3_context ctx, int child, int parent) {
-    char name[40];
+    char name[VAR_NAME_SIZE];
 
-    snprintf(name, 40, "p_[%d,%d]", child, parent);
+    snprintf(name, VAR_NAME_SIZE, "p_[%d,%d]", child, parent);
 
     return mk_bool_var(ctx, name);
 }
 
 Z3_ast getVariableLevelInSpanningTree(Z3_context ctx, int level, int component) {
-    char name[40];
+    char name[VAR_NAME_SIZE];
 
-    snprintf(name, 40, "l_[%d,%d]", component, level);
+    snprintf(name, VAR_NAME_SIZE, "l_[%d,%d]", component, level);
 
     return mk_bool_var(ctx, name);
 }
 
 Z3_ast EdgeConReduction(Z3_context z3_ctx, EdgeConGraph edgeGraph, int cost) {
     g_context_s *ctx;
+    Z3Sink *sink;
+
+    Z3_ast formula;
+
+    ctx = init_g_context(edgeGraph, cost);
+    sink = create_z3_sink(ctx, z3_ctx);
+
+    emit_cost_independent_formulas(ctx);
+    emit_phi_5(ctx);
+    formula = take_z3_formula(sink);
+
+    delete_z3_sink(sink);
+    delete_g_context(ctx);
+
+    return formula;
+}
+
+int EdgeConMaximalCost(Z3Session session, EdgeConGraph edgeGraph, Z3_model *model) {
+    Z3_context z3_ctx = getZ3SessionContext(session);
+    g_context_s *ctx;
+    Z3Sink *sink;
+    int low, high;
+
+    ctx = init_g_context(edgeGraph, 1);
+    sink = create_z3_sink(ctx, z3_ctx);
+
+    emit_cost_independent_formulas(ctx);
+    assertInZ3Session(session, take_z3_formula(sink));
+
+    /* No spanning tree of the C_H components has a diameter greater than N:
+     * the formula is unsatisfiable for the cost N. It is only unsatisfiable
+     * for the cost 0 if there is no valid translator set. */
+    *model = NULL;
+    low = 0;
+    high = ctx->N;
+    while (low < high) {
+        int middle = (low + high) / 2;
+        Z3_ast assumption = Z3_mk_fresh_const(z3_ctx, "cost", Z3_mk_bool_sort(z3_ctx));
+
+        ctx->k = middle;
+        emit_phi_5(ctx);
+        assertInZ3Session(session,
+            OR(2)
+                NOT( assumption ),
+                take_z3_formula(sink)
+            EOR);
+
+        switch (checkZ3SessionAssumptions(session, 1, &assumption)) {
+        case Z3_L_TRUE:
+            if (NULL != *model) {
+                Z3_model_dec_ref(z3_ctx, *model);
+            }
+            *model = getZ3SessionModel(session);
+            Z3_model_inc_ref(z3_ctx, *model);
+            low = middle + 1;
+            break;
+        case Z3_L_FALSE:
+            high = middle;
+            break;
+        case Z3_L_UNDEF:
+            high = -1;
+            low = -1;
+            break;
+        }
+    }
+
+    delete_z3_sink(sink);
+    delete_g_context(ctx);
+
+    if (-1 == high && NULL != *model) {
+        Z3_model_dec_ref(z3_ctx, *model);
+        *model = NULL;
+    }
+    return high;
+}
+
+/**
+ * Writes @p value followed by @p separator (faster than fprintf, there is
+ * one call per literal).
+ */
+static void write_int(FILE *file, int value, char separator) {
+    char digits[16];
+    int start = sizeof(digits);
+    unsigned int magnitude = value < 0 ? -(unsigned int)value : (unsigned int)value;
+
+    digits[--start] = separator;
+    do {
+        digits[--start] = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while (0 != magnitude);
+    if (value < 0) {
+        digits[--start] = '-';
+    }
+    fwrite(digits + start, 1, sizeof(digits) - start, file);
+}
+
+/**
+ * Counts the clause, and writes it.
+ */
+static void add_dimacs_clause(ClauseSink *sink, const int *literals, int numLiterals) {
+    DimacsSink *dimacs = (DimacsSink *)sink;
+
+    dimacs->numClauses++;
+    for (int i = 0; i < numLiterals; i++) {
+        write_int(dimacs->file, literals[i], ' ');
+    }
+    fputs("0\n", dimacs->file);
+}
+
+/**
+ * Copies the content of @p source, from its beginning, at the end of
+ * @p destination.
+ *
+ * @return true if every character was read and written.
+ */
+static bool copy_file(FILE *source, FILE *destination) {
+    char buffer[1 << 16];
+    size_t size;
+
+    rewind(source);
+    while (0 != (size = fread(buffer, 1, sizeof(buffer), source))) {
+        if (fwrite(buffer, 1, size, destination) != size) {
+            return false;
+        }
+    }
+    return !ferror(source);
+}
+
+int EdgeConReductionToDimacs(FILE *file, const EdgeConGraph graph, int cost) {
+    g_context_s *ctx;
+    DimacsSink sink = { { add_dimacs_clause, NULL }, NULL, 0 };
+    int numVars;
+
+    /* The header comes first but needs the number of clauses, so the clauses
+     * are written in a temporary file and copied after the header. */
+    sink.file = tmpfile();
+    if (NULL == sink.file) {
+        perror("tmpfile");
+        return -1;
+    }
+
+    ctx = init_g_context(graph, cost);
+    ctx->sink = &sink.sink;
+    emit_cost_independent_formulas(ctx);
+    emit_phi_5(ctx);
+    numVars = ctx->numVars;
+    delete_g_context(ctx);
+
+    fprintf(file, "p cnf %d %ld\n", numVars, sink.numClauses);
+    if (!copy_file(sink.file, file) || ferror(file)) {
+        perror("EdgeConReductionToDimacs");
+        numVars = -1;
+    }
+    fclose(sink.file);
+
+    return numVars;
+}
+
+/**
+ * Writes the name of a variable as an SMT-LIB2 symbol: the name given by the
+ * getVariable functions for the variables of the tables, aux_v for the
+ * auxiliary variable v.
+ */
+static void write_smtlib_variable(const g_context_s *ctx, FILE *file, int var) {
+    if (var < ctx->firstP) {
+        int e = (var - 1) / ctx->N;
+        fprintf(file, "|x_[(%d,%d),%d]|", ctx->edgeNodes[2 * e], ctx->edgeNodes[2 * e + 1], (var - 1) % ctx->N);
+    }
+    else if (var < ctx->firstL) {
+        fprintf(file, "|p_[%d,%d]|", (var - ctx->firstP) / ctx->C_H, (var - ctx->firstP) % ctx->C_H);
+    }
+    else if (var < ctx->firstL + ctx->C_H * ctx->C_H) {
+        fprintf(file, "|l_[%d,%d]|", (var - ctx->firstL) / ctx->C_H, (var - ctx->firstL) % ctx->C_H);
+    }
+    else {
+        fprintf(file, "aux_%d", var);
+    }
+}
+
+/**
+ * Declares the variables up to the largest one of @p literals, in order of
+ * their numbers. The auxiliary variables are numbered in order of creation,
+ * so each one is declared just before its first use and nothing has to be
+ * stored.
+ */
+static void declare_smtlib_variables(SmtLibSink *smtlib, const int *literals, int numLiterals) {
+    for (int i = 0; i < numLiterals; i++) {
+        while (abs(literals[i]) > smtlib->numDeclared) {
+            fputs("(declare-const ", smtlib->file);
+            write_smtlib_variable(smtlib->ctx, smtlib->file, ++smtlib->numDeclared);
+            fputs(" Bool)\n", smtlib->file);
+        }
+    }
+}
+
+/**
+ * Writes the literals separated by spaces.
+ */
+static void write_smtlib_literals(SmtLibSink *smtlib, const int *literals, int numLiterals) {
+    for (int i = 0; i < numLiterals; i++) {
+        if (0 != i) {
+            fputc(' ', smtlib->file);
+        }
+        if (literals[i] < 0) {
+            fputs("(not ", smtlib->file);
+            write_smtlib_variable(smtlib->ctx, smtlib->file, -literals[i]);
+            fputc(')', smtlib->file);
+        }
+        else {
+            write_smtlib_variable(smtlib->ctx, smtlib->file, literals[i]);
+        }
+    }
+}
+
+static void add_smtlib_clause(ClauseSink *sink, const int *literals, int numLiterals) {
+    SmtLibSink *smtlib = (SmtLibSink *)sink;
+
+    declare_smtlib_variables(smtlib, literals, numLiterals);
+    if (0 == numLiterals) {
+        fputs("(assert false)\n", smtlib->file);
+    }
+    else if (1 == numLiterals) {
+        fputs("(assert ", smtlib->file);
+        write_smtlib_literals(smtlib, literals, numLiterals);
+        fputs(")\n", smtlib->file);
+    }
+    else {
+        fputs("(assert (or ", smtlib->file);
+        write_smtlib_literals(smtlib, literals, numLiterals);
+        fputs("))\n", smtlib->file);
+    }
+}
+
+/**
+ * Writes the cardinality constraint with the at-most operator of Z3.
+ */
+static void add_smtlib_at_most_one(ClauseSink *sink, const int *literals, int numLiterals) {
+    SmtLibSink *smtlib = (SmtLibSink *)sink;
+
+    declare_smtlib_variables(smtlib, literals, numLiterals);
+    fputs("(assert ((_ at-most 1) ", smtlib->file);
+    write_smtlib_literals(smtlib, literals, numLiterals);
+    fputs("))\n", smtlib->file);
+}
+
+void EdgeConReductionToSmtLib(FILE *file, const EdgeConGraph graph, int cost) {
+    g_context_s *ctx;
+    SmtLibSink sink = { { add_smtlib_clause, add_smtlib_at_most_one }, file, NULL, 0 };
+
+    ctx = init_g_context(graph, cost);
+    ctx->sink = &sink.sink;
+    sink.ctx = ctx;
 
-    ctx = init_g_context(z3_ctx, edgeGraph, cost);
+    emit_cost_independent_formulas(ctx);
+    emit_phi_5(ctx);
+    fputs("(check-sat)\n", file);
 
-    return(
-        AND(5)
-            build_phi_2(ctx),
-            build_phi_3(ctx),
-            build_phi_4(ctx),
-            build_phi_5(ctx),
-            build_phi_8(ctx)
-        EAND
-    );
+    delete_g_context(ctx);
 }
 
-static g_context_s *init_g_context(Z3_context z3_ctx, EdgeConGraph graph, int cost) {
+static g_context_s *init_g_context(EdgeConGraph graph, int cost) {
     g_context_s *ctx = NULL;
 
     ctx = malloc(sizeof(g_context_s));
@@ -283,281 +681,554 @@ static g_context_s *init_g_context(Z3_context z3_ctx, EdgeConGraph graph, int co
     ctx->graph = graph;
     ctx->G = getGraph(graph);
     ctx->n = orderG(ctx->G);
-    ctx->m = sizeG(ctx->G);
     ctx->C_H = getNumComponents(graph);
     ctx->N = ctx->C_H - 1;
     ctx->k = cost;
-    ctx->z3_ctx = z3_ctx;
+    ctx->sink = NULL;
+
+    index_edges(ctx);
+
+    ctx->firstP = ctx->m * ctx->N + 1;
+    ctx->firstL = ctx->firstP + ctx->C_H * ctx->C_H;
+    ctx->numVars = ctx->firstL + ctx->C_H * ctx->C_H - 1;
+
+    ctx->numLiterals = 0;
+    ctx->maxLiterals = 16;
+    ctx->literals = malloc(ctx->maxLiterals * sizeof(int));
+    ctx->amoVars = malloc((ctx->m + ctx->C_H + 1) * sizeof(int));
+    assert( NULL != ctx->literals && NULL != ctx->amoVars );
 
     return ctx;
 }
 
+static void delete_g_context(g_context_s *ctx) {
+    free(ctx->edgeNodes);
+    free(ctx->pairOffsets);
+    free(ctx->pairEdges);
+    free(ctx->literals);
+    free(ctx->amoVars);
+    free(ctx);
+}
+
+static void index_edges(g_context_s *ctx) {
+    int numPairs = ctx->C_H * ctx->C_H;
+    int *pairCursors;
+    int e;
+
+    ctx->m = 0;
+    for (unsigned int u = 0; u < ctx->n; u++) {
+        int *neighbours = getNeighbours(ctx->G, u);
+        for (int k = 0; k < degreeG(ctx->G, u); k++) {
+            if (neighbours[k] > (int)u) {
+                ctx->m++;
+            }
+        }
+    }
+
+    ctx->edgeNodes = malloc((2 * ctx->m + 1) * sizeof(int));
+    ctx->pairOffsets = calloc(numPairs + 1, sizeof(int));
+    pairCursors = calloc(numPairs + 1, sizeof(int));
+    assert( NULL != ctx->edgeNodes && NULL != ctx->pairOffsets && NULL != pairCursors );
+
+    /* The neighbours are sorted, so the edges are numbered in lexicographic order. */
+    e = 0;
+    for (unsigned int u = 0; u < ctx->n; u++) {
+        int *neighbours = getNeighbours(ctx->G, u);
+        for (int k = 0; k < degreeG(ctx->G, u); k++) {
+            if (neighbours[k] > (int)u) {
+                ctx->edgeNodes[2 * e] = u;
+                ctx->edgeNodes[2 * e + 1] = neighbours[k];
+                e++;
+            }
+        }
+    }
 
-static Z3_ast build_phi_2(const g_context_s *ctx) {
-    return (
-        AND(2)
-            build_phi_2_1(ctx),
-            build_phi_2_2(ctx)
-        EAND
-    );
+    FORALL_EDGE(e)
+        int c_u = getComponentOfNode(ctx->graph, ctx->edgeNodes[2 * e]);
+        int c_v = getComponentOfNode(ctx->graph, ctx->edgeNodes[2 * e + 1]);
+        if (c_u != c_v) {
+            ctx->pairOffsets[c_v * ctx->C_H + c_u + 1]++;
+        }
+    EFE
+    for (int pair = 0; pair < numPairs; pair++) {
+        ctx->pairOffsets[pair + 1] += ctx->pairOffsets[pair];
+        pairCursors[pair] = ctx->pairOffsets[pair];
+    }
+
+    ctx->pairEdges = malloc((ctx->pairOffsets[numPairs] + 1) * sizeof(int));
+    assert( NULL != ctx->pairEdges );
+    FORALL_EDGE(e)
+        int c_u = getComponentOfNode(ctx->graph, ctx->edgeNodes[2 * e]);
+        int c_v = getComponentOfNode(ctx->graph, ctx->edgeNodes[2 * e + 1]);
+        if (c_u != c_v) {
+            ctx->pairEdges[pairCursors[c_v * ctx->C_H + c_u]++] = e;
+        }
+    EFE
+
+    free(pairCursors);
 }
-static Z3_ast build_phi_2_1(const g_context_s *ctx) {
-    int pos;
-    Z3_ast phi_2_1[ctx->N * (ctx->m * ctx->m - 1)];
 
-    pos = 0;
-    FORALL_TRANSLATOR(i)
-        FORALL_EDGE(e1, e2)
-            FORALL_EDGE(f1, f2)
-                if (e1 != f1 || e2 != f2) {
-                    phi_2_1[pos++] =
-                        OR(2)
-                            NOT( X_(e1, e2, i) ),
-                            NOT( X_(f1, f2, i) )
-                        EOR;
-                }
-            EFE
-        EFE
-    EFI
+static void add_literal(g_context_s *ctx, int literal) {
+    if (ctx->numLiterals == ctx->maxLiterals) {
+        ctx->maxLiterals *= 2;
+        ctx->literals = realloc(ctx->literals, ctx->maxLiterals * sizeof(int));
+        assert( NULL != ctx->literals );
+    }
+    ctx->literals[ctx->numLiterals++] = literal;
+}
 
-    return Z3_mk_and(ctx->z3_ctx, pos, phi_2_1);
+static void end_clause(g_context_s *ctx) {
+    ctx->sink->addClause(ctx->sink, ctx->literals, ctx->numLiterals);
+    ctx->numLiterals = 0;
 }
 
-static Z3_ast build_phi_2_2(const g_context_s *ctx) {
-    int pos;
-    Z3_ast phi_2_2[ (ctx->m * ((ctx->N * ctx->N) / 2)) ];
+static void emit_binary_clause(g_context_s *ctx, int literal1, int literal2) {
+    add_literal(ctx, literal1);
+    add_literal(ctx, literal2);
+    end_clause(ctx);
+}
 
-    if (1 == ctx->N) {
-        return Z3_mk_true(ctx->z3_ctx);
+static int new_variable(g_context_s *ctx) {
+    return ++ctx->numVars;
+}
+
+static void emit_cost_independent_formulas(g_context_s *ctx) {
+    emit_phi_2(ctx);
+    emit_phi_3(ctx);
+    emit_phi_4(ctx);
+    emit_phi_8(ctx);
+    if (symmetryBreaking) {
+        emit_translator_order(ctx);
     }
+}
+
+static void emit_phi_2(g_context_s *ctx) {
+    emit_phi_2_1(ctx);
+    emit_phi_2_2(ctx);
+}
 
-    pos = 0;
-    FORALL_EDGE(e1, e2)
+static void emit_phi_2_1(g_context_s *ctx) {
+    FORALL_TRANSLATOR(i)
+        FORALL_EDGE(e)
+            ctx->amoVars[e] = X_(e, i);
+        EFE
+        emit_at_most_one(ctx, ctx->m, ctx->amoVars);
+    EFI
+}
+
+static void emit_phi_2_2(g_context_s *ctx) {
+    FORALL_EDGE(e)
         FORALL_TRANSLATOR(i)
-            for (int j = i + 1; j < ctx->N; j++) {
-                phi_2_2[pos++] =
-                    OR(2)
-                        NOT( X_(e1, e2, i) ),
-                        NOT( X_(e1, e2, j) )
-                    EOR;
-            }
+            ctx->amoVars[i] = X_(e, i);
         EFI
+        emit_at_most_one(ctx, ctx->N, ctx->amoVars);
     EFE
-
-    return Z3_mk_and(ctx->z3_ctx, pos, phi_2_2);
 }
 
-static Z3_ast build_phi_3(const g_context_s *ctx) {
-    return (
-        AND(2)
-            build_phi_3_1(ctx),
-            build_phi_3_2(ctx)
-        EAND
-    );
+static void emit_phi_3(g_context_s *ctx) {
+    emit_phi_3_1(ctx);
+    emit_phi_3_2(ctx);
+    emit_phi_3_3(ctx);
 }
 
-static Z3_ast build_phi_3_1(const g_context_s *ctx) {
-    int pos, pos2;
-    Z3_ast phi_3_1[ctx->C_H];
-
-    pos = 0;
-    FORALL_COMPONENT_EXCEPT_ROOT(j1)
-        Z3_ast phi_3_1_disj[ctx->C_H];
-
-        pos2 = 0;
+static void emit_phi_3_1(g_context_s *ctx) {
+    FORALL_COMPONENT(j1)
+        add_literal(ctx, L_(j1, 0));
         FORALL_COMPONENT(j2)
             if (j1 != j2) {
-                phi_3_1_disj[pos2++] = P_(j1, j2);
+                add_literal(ctx, P_(j1, j2));
             }
         EFC
-        phi_3_1[pos++] = Z3_mk_or(ctx->z3_ctx, pos2, phi_3_1_disj);
+        end_clause(ctx);
     EFC
-
-    return Z3_mk_and(ctx->z3_ctx, pos, phi_3_1);
 }
 
-static Z3_ast build_phi_3_2(const g_context_s *ctx) {
-    int pos;
-    Z3_ast phi_3_2[ (ctx->C_H - 1) * (ctx->C_H - 1) * (ctx->C_H - 1) ];
+static void emit_phi_3_2(g_context_s *ctx) {
+    FORALL_COMPONENT(j)
+        int numParents = 0;
 
-    pos = 0;
-    FORALL_COMPONENT_EXCEPT_ROOT(j)
         FORALL_COMPONENT(j1)
             if (j1 != j) {
-                for (int j2 = j1 + 1; j2 < ctx->C_H; j2++) {
-                    if (j2 != j) {
-                        phi_3_2[pos++] =
-                            OR(2)
-                                NOT( P_(j, j1) ),
-                                NOT( P_(j, j2) )
-                            EOR;
-                    }
-                }
+                ctx->amoVars[numParents++] = P_(j, j1);
             }
         EFC
+        emit_at_most_one(ctx, numParents, ctx->amoVars);
     EFC
-
-    return Z3_mk_and(ctx->z3_ctx, pos, phi_3_2);
 }
 
-static Z3_ast build_phi_4(const g_context_s *ctx){
-    return (
-        AND(2)
-            build_phi_4_1(ctx),
-            build_phi_4_2(ctx)
-        EAND
-    );
+static void emit_phi_3_3(g_context_s *ctx) {
+    FORALL_COMPONENT(j1)
+        FORALL_COMPONENT(j2)
+            if (j1 != j2) {
+                add_literal(ctx, -L_(j1, 0));
+                add_literal(ctx, -P_(j1, j2));
+                end_clause(ctx);
+            }
+        EFC
+    EFC
 }
 
-static Z3_ast build_phi_4_1(const g_context_s *ctx) {
-    int pos, pos2;
-    Z3_ast phi_4_1[ctx->C_H];
+static void emit_phi_4(g_context_s *ctx){
+    emit_phi_4_1(ctx);
+    emit_phi_4_2(ctx);
+    emit_phi_4_3(ctx);
+}
 
-    pos = 0;
+static void emit_phi_4_1(g_context_s *ctx) {
     FORALL_COMPONENT(i)
-        Z3_ast phi_4_1_disj[ctx->N];
-
-        pos2 = 0;
         FORALL_LEVEL(n)
-            phi_4_1_disj[pos2++] = L_(i, n);
+            add_literal(ctx, L_(i, n));
         EFL
-        phi_4_1[pos++] = Z3_mk_or(ctx->z3_ctx, pos2, phi_4_1_disj);
+        end_clause(ctx);
     EFC
-
-    return Z3_mk_and(ctx->z3_ctx, pos, phi_4_1);
 }
 
-static Z3_ast build_phi_4_2(const g_context_s *ctx) {
-    int pos;
-    Z3_ast phi_4_2[ ctx->C_H * (ctx->N * ctx->N) ];
-
-    pos = 0;
+static void emit_phi_4_2(g_context_s *ctx) {
     FORALL_COMPONENT(i)
-        FORALL_LEVEL(n1)
-            for (int n2 = n1 + 1; n2 < ctx->N; ++n2) {
-                phi_4_2[pos++] =
-                    OR(2)
-                        NOT( L_(i, n1) ),
-                        NOT( L_(i, n2) )
-                    EOR;
-            }
+        FORALL_LEVEL(n)
+            ctx->amoVars[n] = L_(i, n);
         EFL
+        emit_at_most_one(ctx, ctx->C_H, ctx->amoVars);
     EFC
-
-    return Z3_mk_and(ctx->z3_ctx, pos, phi_4_2);
 }
 
-static Z3_ast build_phi_5(const g_context_s *ctx) {
-    int pos;
-    Z3_ast phi_5[
-        ctx->C_H *
-        (ctx->N <= ctx->k ? ctx->N : (ctx->N - ctx->k))
-    ];
+static void emit_phi_4_3(g_context_s *ctx) {
+    FORALL_COMPONENT(i)
+        ctx->amoVars[i] = L_(i, 0);
+    EFC
+    emit_at_most_one(ctx, ctx->C_H, ctx->amoVars);
+}
 
-    pos = 0;
+static void emit_phi_5(g_context_s *ctx) {
     FORALL_COMPONENT(i)
-        for (int n = ctx->k; n < ctx->N; ++n) {
-            phi_5[pos++] = L_(i, n);
+        for (int n = ctx->k + 1; n < ctx->C_H; ++n) {
+            add_literal(ctx, L_(i, n));
         }
     EFC
-
-    return Z3_mk_or(ctx->z3_ctx, pos, phi_5);
+    end_clause(ctx);
 }
 
-static Z3_ast build_phi_8(const g_context_s *ctx) {
-    int pos;
-    Z3_ast phi_8[ctx->C_H * ctx->C_H];
-
-    pos = 0;
+static void emit_phi_8(g_context_s *ctx) {
     FORALL_COMPONENT(j1)
         FORALL_COMPONENT(j2)
             if (j1 != j2) {
-                phi_8[pos++] =
-                    AND(2)
-                        OR(2)
-                            NOT( P_(j1, j2) ),
-                            build_phi_6(ctx, j1, j2)
-                        EOR,
-                        OR(2)
-                            NOT( P_(j1, j2) ),
-                            build_phi_7(ctx, j1, j2)
-                        EOR
-                    EAND;
+                add_literal(ctx, -P_(j1, j2));
+                add_phi_6(ctx, j1, j2);
+                end_clause(ctx);
+                emit_phi_7(ctx, -P_(j1, j2), j1, j2);
             }
         EFC
     EFC
+}
+
+static void add_phi_6(g_context_s *ctx, const int j1, const int j2) {
+    /* The edges (u, v), u < v, with v in X_j1 and u in X_j2, then the ones
+     * with u in X_j1 and v in X_j2. */
+    const int pairs[2] = { j1 * ctx->C_H + j2, j2 * ctx->C_H + j1 };
+
+    for (int p = 0; p < 2; p++) {
+        for (int k = ctx->pairOffsets[pairs[p]]; k < ctx->pairOffsets[pairs[p] + 1]; k++) {
+            FORALL_TRANSLATOR(i)
+                add_literal(ctx, X_(ctx->pairEdges[k], i));
+            EFI
+        }
+    }
+}
+
+static void emit_phi_7(g_context_s *ctx, int guard, const int j1, const int j2) {
+    for (int h = 1; h < ctx->C_H; ++h) {
+        add_literal(ctx, guard);
+        add_literal(ctx, -L_(j1, h));
+        add_literal(ctx, L_(j2, h - 1));
+        end_clause(ctx);
+    }
+}
+
+static void emit_translator_order(g_context_s *ctx) {
+    for (int i = 0; i + 1 < (int)ctx->N; i++) {
+        int before = 0;
+
+        FORALL_EDGE(e)
+            add_literal(ctx, -X_(e, i + 1));
+            if (0 != before) {
+                add_literal(ctx, before);
+            }
+            end_clause(ctx);
+
+            if (e + 1 < ctx->m) {
+                int upTo = new_variable(ctx);
+                add_literal(ctx, -upTo);
+                add_literal(ctx, X_(e, i));
+                if (0 != before) {
+                    add_literal(ctx, before);
+                }
+                end_clause(ctx);
+                before = upTo;
+            }
+        EFE
+    }
+}
+
+void setSymmetryBreaking(bool enabled) {
+    symmetryBreaking = enabled;
+}
 
-    return Z3_mk_and(ctx->z3_ctx, pos, phi_8);
+void setAtMostOneEncoding(AtMostOneEncoding encoding) {
+    amoEncoding = encoding;
 }
 
-static Z3_ast build_phi_6(const g_context_s *ctx, const int j1, const int j2) {
-    int pos;
-    Z3_ast phi_6[ctx->m * ctx->N];
+bool getAtMostOneEncodingFromName(const char *name, AtMostOneEncoding *encoding) {
+    static const char *names[] = { "pairwise", "sequential", "product", "pb" };
+    static const AtMostOneEncoding encodings[] = { AMO_PAIRWISE, AMO_SEQUENTIAL, AMO_PRODUCT, AMO_PB };
 
-    pos = 0;
-    FORALL_EDGE(u, v)
-        if (isNodeInComponent(ctx->graph, v, j1) &&
-            isNodeInComponent(ctx->graph, u, j2))
-        {
-            FORALL_LEVEL(i)
-                phi_6[pos++] = X_(u, v, i);
-            EFL
+    for (unsigned int i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+        if (0 == strcmp(name, names[i])) {
+            *encoding = encodings[i];
+            return true;
         }
-    EFE
+    }
+    return false;
+}
 
-    if (0 == pos) {
-        return Z3_mk_false(ctx->z3_ctx);
+/**
+ * Pairwise encoding: not both, for every pair of variables.
+ */
+static void emit_at_most_one_pairwise(g_context_s *ctx, int numVars, const int *vars) {
+    for (int v1 = 0; v1 < numVars; v1++) {
+        for (int v2 = v1 + 1; v2 < numVars; v2++) {
+            emit_binary_clause(ctx, -vars[v1], -vars[v2]);
+        }
     }
+}
+
+/**
+ * Sequential counter: the auxiliary variable s_v is true if one of the
+ * variables 0 to v is true, and a variable cannot be true if s of the
+ * previous one is.
+ */
+static void emit_at_most_one_sequential(g_context_s *ctx, int numVars, const int *vars) {
+    int s, previous;
 
-    return Z3_mk_or(ctx->z3_ctx, pos, phi_6);
+    previous = 0;
+    for (int v = 0; v < numVars; v++) {
+        if (0 != previous) {
+            emit_binary_clause(ctx, -vars[v], -previous);
+        }
+        if (v == numVars - 1) {
+            break;
+        }
+        s = new_variable(ctx);
+        emit_binary_clause(ctx, -vars[v], s);
+        if (0 != previous) {
+            emit_binary_clause(ctx, -previous, s);
+        }
+        previous = s;
+    }
 }
 
-static Z3_ast build_phi_7(const g_context_s *ctx, const int j1, const int j2) {
-    int pos;
-    Z3_ast phi_7[ctx->N];
+/**
+ * Product encoding: the variables are laid out in a grid, each one implies its
+ * row and its column, and at most one row and one column can be selected
+ * (recursively).
+ */
+static void emit_at_most_one_product(g_context_s *ctx, int numVars, const int *vars) {
+    int numRows, numColumns;
+    int *rows, *columns;
+
+    if (numVars <= 4) {
+        emit_at_most_one_pairwise(ctx, numVars, vars);
+        return;
+    }
 
-    pos = 0;
-    for (int h = 1; h < ctx->N; ++h) {
-        phi_7[pos++] =
-            OR(2)
-                NOT( L_(j1, h) ),
-                L_(j2, h - 1)
-            EOR;
+    for (numRows = 1; numRows * numRows < numVars; numRows++);
+    numColumns = (numVars + numRows - 1) / numRows;
+
+    rows = malloc((numRows + numColumns) * sizeof(int));
+    assert( NULL != rows );
+    columns = rows + numRows;
+    for (int r = 0; r < numRows; r++) {
+        rows[r] = new_variable(ctx);
+    }
+    for (int c = 0; c < numColumns; c++) {
+        columns[c] = new_variable(ctx);
     }
 
-    return Z3_mk_and(ctx->z3_ctx, pos, phi_7);
+    for (int v = 0; v < numVars; v++) {
+        emit_binary_clause(ctx, -vars[v], rows[v / numColumns]);
+        emit_binary_clause(ctx, -vars[v], columns[v % numColumns]);
+    }
+    emit_at_most_one_product(ctx, numRows, rows);
+    emit_at_most_one_product(ctx, numColumns, columns);
+
+    free(rows);
 }
 
-void getTranslatorSetFromModel(Z3_context ctx, Z3_model model, EdgeConGraph graph) {
-    int n;
-    int N;
+static void emit_at_most_one(g_context_s *ctx, int numVars, const int *vars) {
+    if (numVars <= 1) {
+        return;
+    }
+
+    switch (amoEncoding) {
+    case AMO_SEQUENTIAL:
+        emit_at_most_one_sequential(ctx, numVars, vars);
+        break;
+    case AMO_PRODUCT:
+        emit_at_most_one_product(ctx, numVars, vars);
+        break;
+    case AMO_PB:
+        /* Only Z3 has cardinality constraints, the other sinks take the
+         * sequential counter instead. */
+        if (NULL != ctx->sink->addAtMostOne) {
+            ctx->sink->addAtMostOne(ctx->sink, vars, numVars);
+        }
+        else {
+            emit_at_most_one_sequential(ctx, numVars, vars);
+        }
+        break;
+    case AMO_PAIRWISE:
+    default:
+        emit_at_most_one_pairwise(ctx, numVars, vars);
+        break;
+    }
+}
 
-    n = orderG(getGraph(graph));
-    N = getNumComponents(graph) - 1;
+/**
+ * Returns the Z3 formula of a literal, creating the auxiliary variables up to
+ * it if needed.
+ */
+static Z3_ast z3_literal(Z3Sink *sink, int literal) {
+    Z3_context z3_ctx = sink->z3_ctx;
+    int var = abs(literal);
 
-    for (int n1 = 0; n1 < n; ++n1) {
-        for (int n2 = n1 + 1; n2 < n; ++n2) {
-            if (isEdge(getGraph(graph), n1, n2)) {
-                for (int i = 0; i < N; ++i) {
-                    if (is_the_ith_translator(ctx, model, graph, n1, n2, i)) {
-                        addTranslator(graph, n1, n2);
-                    }
-                }
-            }
+    if (var > sink->maxVars) {
+        while (var > sink->maxVars) {
+            sink->maxVars *= 2;
         }
+        sink->vars = realloc(sink->vars, (sink->maxVars + 1) * sizeof(Z3_ast));
+        assert( NULL != sink->vars );
+    }
+    while (var > sink->numVars) {
+        sink->vars[++sink->numVars] = Z3_mk_fresh_const(z3_ctx, "aux", Z3_mk_bool_sort(z3_ctx));
+    }
+
+    return literal > 0 ? sink->vars[var] : NOT( sink->vars[var] );
+}
+
+static void add_z3_clause(ClauseSink *clauseSink, const int *literals, int numLiterals) {
+    Z3Sink *sink = (Z3Sink *)clauseSink;
+    AstBuffer clause = openAstBuffer(sink->arena);
+
+    for (int i = 0; i < numLiterals; i++) {
+        pushAst(&clause, z3_literal(sink, literals[i]));
+    }
+    Z3_ast formula = Z3_mk_or(sink->z3_ctx, clause.size, getAsts(&clause));
+    closeAstBuffer(&clause);
+    pushAst(&sink->clauses, formula);
+}
+
+static void add_z3_at_most_one(ClauseSink *clauseSink, const int *literals, int numLiterals) {
+    Z3Sink *sink = (Z3Sink *)clauseSink;
+    AstBuffer vars = openAstBuffer(sink->arena);
+
+    for (int i = 0; i < numLiterals; i++) {
+        pushAst(&vars, z3_literal(sink, literals[i]));
+    }
+    Z3_ast formula = Z3_mk_atmost(sink->z3_ctx, vars.size, getAsts(&vars), 1);
+    closeAstBuffer(&vars);
+    pushAst(&sink->clauses, formula);
+}
+
+static Z3Sink *create_z3_sink(g_context_s *ctx, Z3_context z3_ctx) {
+    Z3Sink *sink = malloc(sizeof(Z3Sink));
+    assert( NULL != sink );
+
+    sink->sink.addClause = add_z3_clause;
+    sink->sink.addAtMostOne = add_z3_at_most_one;
+    sink->z3_ctx = z3_ctx;
+    sink->numVars = ctx->numVars;
+    sink->maxVars = MAX(ctx->numVars, 1);
+    sink->vars = calloc(sink->maxVars + 1, sizeof(Z3_ast));
+    assert( NULL != sink->vars );
+
+    FORALL_EDGE(e)
+        FORALL_TRANSLATOR(i)
+            sink->vars[X_(e, i)] = getVariableIsIthTranslator(z3_ctx, ctx->edgeNodes[2 * e], ctx->edgeNodes[2 * e + 1], i);
+        EFI
+    EFE
+
+    FORALL_COMPONENT(j1)
+        FORALL_COMPONENT(j2)
+            if (j1 != j2) {
+                sink->vars[P_(j1, j2)] = getVariableParent(z3_ctx, j1, j2);
+            }
+        EFC
+        FORALL_LEVEL(h)
+            sink->vars[L_(j1, h)] = getVariableLevelInSpanningTree(z3_ctx, h, j1);
+        EFL
+    EFC
+
+    sink->arena = createAstArena();
+    sink->clauses = openAstBuffer(sink->arena);
+    ctx->sink = &sink->sink;
+
+    return sink;
+}
+
+static void delete_z3_sink(Z3Sink *sink) {
+    closeAstBuffer(&sink->clauses);
+    deleteAstArena(sink->arena);
+    free(sink->vars);
+    free(sink);
+}
+
+static Z3_ast take_z3_formula(Z3Sink *sink) {
+    Z3_ast formula = Z3_mk_and(sink->z3_ctx, sink->clauses.size, getAsts(&sink->clauses));
+
+    closeAstBuffer(&sink->clauses);
+    sink->clauses = openAstBuffer(sink->arena);
+    return formula;
+}
+
+void getTranslatorSetFromModel(Z3_context z3_ctx, Z3_model model, EdgeConGraph graph) {
+    g_context_s *ctx = init_g_context(graph, 1);
+    int numX = ctx->m * ctx->N;
+    Z3_ast *vars = malloc((numX > 0 ? numX : 1) * sizeof(Z3_ast));
+    uint64_t *values = createBitset(numX);
+    int numWords = numWordsOfBitset(numX);
+
+    assert( NULL != vars && NULL != values );
+
+    /* The variable x_[(u,v),i] is at X_(e, i) - 1: the values of all of them
+     * are read from the model at once. */
+    FORALL_EDGE(e)
+        FORALL_TRANSLATOR(i)
+            vars[X_(e, i) - 1] = getVariableIsIthTranslator(z3_ctx, ctx->edgeNodes[2 * e], ctx->edgeNodes[2 * e + 1], i);
+        EFI
+    EFE
+    valuesOfVarsInModel(z3_ctx, model, numX, vars, values);
+
+    for (int var = nextSetBit(values, numWords, 0); var >= 0; var = nextSetBit(values, numWords, var + 1)) {
+        int e = var / ctx->N;
+        addTranslator(graph, ctx->edgeNodes[2 * e], ctx->edgeNodes[2 * e + 1]);
     }
+
+    deleteBitset(values);
+    free(vars);
+    delete_g_context(ctx);
     computesHomogeneousComponents(graph);
 }
 
-static bool is_the_ith_translator(
-    const Z3_context ctx,
-    const Z3_model model,
-    const EdgeConGraph graph,
-    const int n1,
-    const int n2,
-    const int i
-) {
-    return(
-        valueOfVarInModel(ctx, model, getVariableIsIthTranslator(ctx, n1, n2, i))
-    );
+void getTranslatorSetFromAssignment(const bool *assignment, EdgeConGraph graph) {
+    g_context_s *ctx = init_g_context(graph, 1);
+
+    FORALL_EDGE(e)
+        FORALL_TRANSLATOR(i)
+            if (assignment[X_(e, i)]) {
+                addTranslator(graph, ctx->edgeNodes[2 * e], ctx->edgeNodes[2 * e + 1]);
+            }
+        EFI
+    EFE
+
+    delete_g_context(ctx);
+    computesHomogeneousComponents(graph);
 }
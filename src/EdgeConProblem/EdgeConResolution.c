@@ -1,131 +1,335 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <pthread.h>
+#include <stdatomic.h>
 
 #include "EdgeConResolution.h"
 #include "Graph.h"
-#include "BruteForceUtils.h"
+#include "ComponentGraph.h"
+#include "SpanningTreeEnumerator.h"
 
-int MaxCost(Graph graph, bool *C);
-int MaxCostAux(Graph graph, bool *C, int n, int *col);
+/** With several threads, the spanning trees are split in at least this number of groups per thread. */
+#define GROUPS_PER_THREAD 64
 
-int BruteForceEdgeCon(EdgeConGraph graph) {
-    Graph g = getGraph(graph);
-    int numHeteregeneousEdges = getNumHeteregeneousEdges(graph);
-    int heterogeneousEdges[numHeteregeneousEdges];
-    int N;
-    int cost;
-    int n = orderG(g);
-    int maxSubHt;
-    int numSubHt;
-    bool subSetOfHt[n * n];
-    bool valid;
-
-    N = getNumComponents(graph) - 1;
-    maxSubHt = binCoeff(numHeteregeneousEdges, N);
-
-    if (0 == maxSubHt) {
-        return -1;
-    }
-
-    getHeterogeneousEdges(graph, heterogeneousEdges);
-
-    for (int k = 1; k <= N; k++) {
-        valid = true;
-        numSubHt = 0;
-        while (valid && numSubHt < maxSubHt) {
-            memset(subSetOfHt, 0, sizeof(bool) * n * n);
-
-            getSubSetOfHeterogeneousEdges(
-                heterogeneousEdges,
-                numHeteregeneousEdges,
-                N,
-                numSubHt,
-                subSetOfHt
-            );
-
-            cost = MaxCost(g, subSetOfHt);
-            if (cost > 0 && cost > k) {
-                valid = false;
-            }
-            ++numSubHt;
+/** The evaluation of spanning trees of the component graph by a worker thread. */
+typedef struct {
+    ComponentGraph cg;                 ///< The quotient of the graph by its homogeneous components.
+    SpanningTreeEnumerator enumerator; ///< The enumerator of spanning trees of this worker.
+    int k;                             ///< The cost to check.
+    const int *prefixes;               ///< The groups of trees, given by their smallest edges (see splitSpanningTrees).
+    int prefixLength;                  ///< The number of edges identifying a group.
+    int numGroups;                     ///< The number of groups.
+    atomic_int *nextGroup;             ///< Shared by all workers: the next group of trees to enumerate.
+    atomic_bool *refuted;              ///< Shared by all workers: set as soon as a tree has a cost greater than k.
+    bool refutedHere;                  ///< True if this worker found a tree of cost greater than k.
+    bool hasTree;                      ///< True if this worker visited at least one tree.
+    int *tree;                         ///< The edges of the last tree visited.
+} BruteForceTask;
+
+/**
+ * @brief SpanningTreeVisitor computing the cost of a tree. Stops the enumeration if the cost is greater than the cost
+ * to check or if another worker found such a tree.
+ *
+ * @param treeEdges The edges of the tree.
+ * @param numEdges The number of edges of the tree.
+ * @param data A BruteForceTask.
+ * @return true To continue the enumeration.
+ * @return false To stop it.
+ */
+static bool evaluateTree(const int *treeEdges, int numEdges, void *data) {
+    BruteForceTask *task = data;
+
+    if (atomic_load_explicit(task->refuted, memory_order_relaxed)) {
+        return false;
+    }
+
+    memcpy(task->tree, treeEdges, numEdges * sizeof(int));
+    task->hasTree = true;
+
+    if (sumOfTreeDiameters(task->cg, treeEdges, numEdges) > task->k) {
+        task->refutedHere = true;
+        atomic_store(task->refuted, true);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Enumerates the spanning trees of the groups taken from the shared counter, until there are no more groups or
+ * a tree refutes the cost to check.
+ *
+ * @param arg A BruteForceTask.
+ * @return NULL.
+ */
+static void *evaluateTrees(void *arg) {
+    BruteForceTask *task = arg;
+
+    task->refutedHere = false;
+    for (int group = atomic_fetch_add(task->nextGroup, 1); group < task->numGroups;
+         group = atomic_fetch_add(task->nextGroup, 1)) {
+        if (!enumerateSpanningTrees(task->enumerator, task->prefixes + group * task->prefixLength,
+                                    task->prefixLength, evaluateTree, task)) {
+            break;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Tells if every spanning tree of the component graph allows nodes to communicate with cost at most @p k. The
+ * worker threads (the first one being the calling thread) take the groups of trees one after the other.
+ *
+ * @param tasks The tasks, with all fields but k set.
+ * @param numThreads The number of tasks.
+ * @param k The cost.
+ * @return BruteForceTask* The task whose last tree refutes @p k, or NULL if every tree has a cost at most @p k.
+ */
+static BruteForceTask *findTreeCostingMore(BruteForceTask *tasks, int numThreads, int k) {
+    pthread_t threads[numThreads];
+    bool started[numThreads];
+    atomic_int nextGroup;
+    atomic_bool refuted;
+
+    atomic_init(&nextGroup, 0);
+    atomic_init(&refuted, false);
+    for (int t = 0; t < numThreads; t++) {
+        tasks[t].k = k;
+        tasks[t].nextGroup = &nextGroup;
+        tasks[t].refuted = &refuted;
+    }
+
+    /* A worker that cannot be started is not needed: the others take its share of the trees. */
+    for (int t = 1; t < numThreads; t++) {
+        int error = pthread_create(&threads[t], NULL, evaluateTrees, &tasks[t]);
+        started[t] = 0 == error;
+        if (!started[t]) {
+            fprintf(stderr, "pthread_create: %s\n", strerror(error));
+            tasks[t].refutedHere = false;
         }
-        if (valid) {
-            updateGraphTranslators(graph, subSetOfHt);
-            computesHomogeneousComponents(graph);
-            return k;
+    }
+    evaluateTrees(&tasks[0]);
+    for (int t = 1; t < numThreads; t++) {
+        int error = started[t] ? pthread_join(threads[t], NULL) : 0;
+        if (0 != error) {
+            fprintf(stderr, "pthread_join: %s\n", strerror(error));
+            exit(EXIT_FAILURE);
         }
     }
 
-    updateGraphTranslators(graph, subSetOfHt);
-    computesHomogeneousComponents(graph);
-    return N;
+    for (int t = 0; t < numThreads; t++) {
+        if (tasks[t].refutedHere) {
+            return &tasks[t];
+        }
+    }
+    return NULL;
 }
 
-#define WHITE 0
-#define GREY  1
-#define BLACK 2
+int BruteForceEdgeCon(EdgeConGraph graph) {
+    return ParallelBruteForceEdgeCon(graph, 1);
+}
 
-int MaxCost(Graph graph, bool *C) {
-    int max = 0;
-    int n = orderG(graph);
-    int maxPrime;
-    int col[orderG(graph)];
+int ParallelBruteForceEdgeCon(EdgeConGraph graph, int numThreads) {
+    ComponentGraph cg = initializeComponentGraph(graph);
+    int N = orderCG(cg) - 1;
+    int result = N;
+    BruteForceTask *tasks;
+    int witness[N + 1];
+    int node1, node2;
+    SpanningTreeEnumerator enumerator = createSpanningTreeEnumerator(cg);
+    int *prefixes;
+    int prefixLength;
+    int numGroups;
 
-    for (int node = 0; node < n; node++) {
-        maxPrime = MaxCostAux(graph, C, node, col);
+    if (numThreads > MAX_BRUTE_FORCE_THREADS) {
+        numThreads = MAX_BRUTE_FORCE_THREADS;
+    }
+
+    /* Many more groups than threads, so that a thread finishing early takes some of the work left by the others. */
+    numGroups = splitSpanningTrees(enumerator, numThreads > 1 ? GROUPS_PER_THREAD * numThreads : 1, &prefixes,
+                                   &prefixLength);
+    deleteSpanningTreeEnumerator(enumerator);
+    if (0 == numGroups) {
+        result = -1;
+    }
+    if (numGroups < numThreads) {
+        numThreads = numGroups > 0 ? numGroups : 1;
+    }
+    tasks = (BruteForceTask *)malloc(numThreads * sizeof(BruteForceTask));
+    for (int t = 0; t < numThreads; t++) {
+        tasks[t].cg = cg;
+        tasks[t].enumerator = createSpanningTreeEnumerator(cg);
+        tasks[t].prefixes = prefixes;
+        tasks[t].prefixLength = prefixLength;
+        tasks[t].numGroups = numGroups;
+        tasks[t].hasTree = false;
+        tasks[t].tree = (int *)malloc((N + 1) * sizeof(int));
+    }
 
-        for (int i = 0; i < n; i++) {
-            if (col[i] == WHITE) {
-                return 0;
+    /* The tree refuting k - 1 has cost k: it is kept as the translator set reaching the bound. */
+    for (int k = 1; k <= N && result >= 0; k++) {
+        BruteForceTask *refutation = findTreeCostingMore(tasks, numThreads, k);
+        if (NULL == refutation) {
+            result = k;
+            for (int t = 0; k == 1 && t < numThreads; t++) {
+                if (tasks[t].hasTree) {
+                    memcpy(witness, tasks[t].tree, N * sizeof(int));
+                    break;
+                }
             }
+            break;
         }
+        memcpy(witness, refutation->tree, N * sizeof(int));
+    }
 
-        if (maxPrime > max) {
-            max = maxPrime;
+    if (result >= 0) {
+        for (int i = 0; i < N; i++) {
+            getEdgeNodes(cg, witness[i], &node1, &node2);
+            addTranslator(graph, node1, node2);
         }
+        computesHomogeneousComponents(graph);
+    }
+    for (int t = 0; t < numThreads; t++) {
+        deleteSpanningTreeEnumerator(tasks[t].enumerator);
+        free(tasks[t].tree);
     }
+    free(tasks);
+    free(prefixes);
+    deleteComponentGraph(cg);
+    return result;
+}
+
+/** The state of the branch and bound search. */
+typedef struct {
+    EdgeConGraph graph;          ///< The instance, whose translators are the current partial tree (incremental mode).
+    ComponentGraph cg;           ///< The quotient of the graph by its homogeneous components.
+    int *treeEdges;              ///< The edges of the component graph in the current partial tree.
+    int numTreeEdges;            ///< The number of edges of the current partial tree.
+    int *bestTree;               ///< The edges of the most costly tree found so far.
+    int best;                    ///< The cost of bestTree, -1 if no tree has been found yet.
+    SearchStatistics statistics; ///< The counters of the search.
+} BranchAndBound;
+
+/**
+ * @brief Bounds the cost of any spanning tree containing the current partial tree. A path of the final tree crosses
+ * each tree of the partial forest along a single subpath, and the r edges still to add link r + 1 such trees, so the
+ * cost is at most r plus the sum of the diameters of the trees of the forest. This bound is exact for a complete tree.
+ *
+ * @param bb The search.
+ * @return int The bound.
+ */
+static int upperBoundOfCost(BranchAndBound *bb) {
+    return orderCG(bb->cg) - 1 - bb->numTreeEdges + sumOfTreeDiameters(bb->cg, bb->treeEdges, bb->numTreeEdges);
+}
+
+/**
+ * @brief Tells if the translators of the current partial tree together with the edges from @p firstEdge on connect
+ * the graph.
+ *
+ * @param bb The search.
+ * @param firstEdge The first remaining edge of the component graph.
+ * @return true If the graph is connected.
+ * @return false Otherwise.
+ */
+static bool canBeCompleted(BranchAndBound *bb, int firstEdge) {
+    int lastEdge = firstEdge;
+    int node1, node2;
+    bool connected;
 
-    return max;
+    for (; lastEdge < sizeCG(bb->cg) && getNumComponents(bb->graph) > 1; lastEdge++) {
+        getEdgeNodes(bb->cg, lastEdge, &node1, &node2);
+        addTranslator(bb->graph, node1, node2);
+    }
+    connected = getNumComponents(bb->graph) == 1;
+    // Removed in reverse order, the cheap case of the incremental mode.
+    while (lastEdge-- > firstEdge) {
+        getEdgeNodes(bb->cg, lastEdge, &node1, &node2);
+        removeTranslator(bb->graph, node1, node2);
+    }
+    return connected;
 }
 
-int MaxCostAux(Graph graph, bool *C, int s, int *col) {
-    int n = orderG(graph);
-    int queueNodesMaxSize = n;
-    int queueNodes[queueNodesMaxSize];
-    int queueNodesRear = -1;
-    int queueNodesFront = -1;
-    int cost[ n ];
-
-    memset(col, WHITE, sizeof(int) * n);
-    memset(cost, WHITE, sizeof(int) * n);
-
-    col[s] = GREY;
-    queueAdd(s, queueNodes, &queueNodesRear, &queueNodesFront, queueNodesMaxSize);
-
-    int x;
-    while (queueNodesRear >= queueNodesFront) {
-        x = queuePop(queueNodes, &queueNodesRear, &queueNodesFront);
-        if (x == -1) {
-            return -1;
+/**
+ * @brief Explores the spanning trees extending the current partial tree with edges from @p edge on, each edge being
+ * either added as a translator or left out.
+ *
+ * @param bb The search.
+ * @param edge The next edge of the component graph to decide.
+ * @pre The partial tree together with the edges from @p edge on connect the graph.
+ */
+static void branchAndBound(BranchAndBound *bb, int edge) {
+    int node1, node2;
+
+    bb->statistics.numExploredNodes++;
+    int bound = upperBoundOfCost(bb);
+    if (bb->numTreeEdges == orderCG(bb->cg) - 1) {
+        if (bound > bb->best) {
+            bb->best = bound;
+            memcpy(bb->bestTree, bb->treeEdges, bb->numTreeEdges * sizeof(int));
+        }
+        return;
+    }
+    if (bound <= bb->best) {
+        bb->statistics.numPrunedNodes++;
+        return;
+    }
+
+    for (; bb->best < orderCG(bb->cg) - 1; edge++) {
+        getEdgeNodes(bb->cg, edge, &node1, &node2);
+        if (areInSameComponent(bb->graph, node1, node2)) {
+            continue;
         }
+        addTranslator(bb->graph, node1, node2);
+        bb->treeEdges[bb->numTreeEdges++] = edge;
+        branchAndBound(bb, edge + 1);
+        bb->numTreeEdges--;
+        removeTranslator(bb->graph, node1, node2);
+        if (!canBeCompleted(bb, edge + 1)) {
+            return;
+        }
+    }
+}
 
-        for (int y = 0; y < n; y++) {
-            if (isEdge(graph, x, y)) {
-                if (col[y] == WHITE) {
-                    cost[y] = cost[x];
+int BranchAndBoundEdgeCon(EdgeConGraph graph, SearchStatistics *statistics) {
+    ComponentGraph cg;
+    int numComponents;
+    int result;
+    int node1, node2;
+    BranchAndBound bb;
 
-                    /* If (x, y) includes in C */
-                    if ((x < y && C[x * n + y]) || C[y * n + x]) {
-                        ++cost[y];
-                    }
+    resetTranslator(graph);
+    cg = initializeComponentGraph(graph);
+    numComponents = orderCG(cg);
 
-                    col[y] = GREY;
-                    queueAdd(y, queueNodes, &queueNodesRear, &queueNodesFront, queueNodesMaxSize);
-                }
-            }
+    bb.graph = graph;
+    bb.cg = cg;
+    bb.treeEdges = (int *)malloc(numComponents * sizeof(int));
+    bb.numTreeEdges = 0;
+    bb.bestTree = (int *)malloc(numComponents * sizeof(int));
+    bb.best = -1;
+    bb.statistics.numExploredNodes = 0;
+    bb.statistics.numPrunedNodes = 0;
+
+    setIncrementalComponents(graph, true);
+    if (canBeCompleted(&bb, 0)) {
+        branchAndBound(&bb, 0);
+    }
+    setIncrementalComponents(graph, false);
+
+    result = bb.best;
+    if (result >= 0) {
+        for (int i = 0; i < numComponents - 1; i++) {
+            getEdgeNodes(cg, bb.bestTree[i], &node1, &node2);
+            addTranslator(graph, node1, node2);
         }
-        col[x] = BLACK;
     }
-    return maxOfArray(cost, n);
-}
\ No newline at end of file
+    computesHomogeneousComponents(graph);
+
+    if (NULL != statistics) {
+        *statistics = bb.statistics;
+    }
+    free(bb.treeEdges);
+    free(bb.bestTree);
+    deleteComponentGraph(cg);
+    return result;
+}
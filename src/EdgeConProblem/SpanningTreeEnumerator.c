@@ -0,0 +1,186 @@
+#include "SpanningTreeEnumerator.h"
+#include "UnionFind.h"
+#include <stdlib.h>
+#include <string.h>
+
+struct SpanningTreeEnumerator_s
+{
+    ComponentGraph cg;     ///< The graph whose spanning trees are enumerated.
+    UnionFind contraction; ///< The components linked by the edges of the current partial tree.
+    int *treeEdges;        ///< The edges of the current partial tree.
+    int numTreeEdges;      ///< The number of edges of the current partial tree.
+    int numVisitedEdges;   ///< The number of edges of the partial trees given to the visitor.
+};
+
+/** The groups of spanning trees built by splitSpanningTrees, all identified by the same number of edges. */
+typedef struct
+{
+    int *prefixes;  ///< The smallest edges of the trees of each group, one group after the other.
+    int numGroups;  ///< The number of groups.
+    int capacity;   ///< The number of groups prefixes can hold.
+    int numEdges;   ///< The number of edges identifying a group.
+} SpanningTreeGroups;
+
+SpanningTreeEnumerator createSpanningTreeEnumerator(const ComponentGraph cg)
+{
+    SpanningTreeEnumerator enumerator = (SpanningTreeEnumerator)malloc(sizeof(*enumerator));
+    enumerator->cg = cg;
+    enumerator->contraction = createUnionFind(orderCG(cg));
+    enumerator->treeEdges = (int *)malloc(orderCG(cg) * sizeof(int));
+    enumerator->numTreeEdges = 0;
+    enumerator->numVisitedEdges = orderCG(cg) - 1;
+    return enumerator;
+}
+
+void deleteSpanningTreeEnumerator(SpanningTreeEnumerator enumerator)
+{
+    deleteUnionFind(enumerator->contraction);
+    free(enumerator->treeEdges);
+    free(enumerator);
+}
+
+/**
+ * @brief Tells if the edges of the current partial tree together with the edges from @p firstEdge on connect the
+ * ComponentGraph.
+ *
+ * @param enumerator An enumerator, recording the merges of its contraction.
+ * @param firstEdge The first remaining edge.
+ * @return true If the graph is connected.
+ * @return false Otherwise.
+ */
+static bool isConnectedFrom(SpanningTreeEnumerator enumerator, int firstEdge)
+{
+    int numMerges = getNumRecordedMerges(enumerator->contraction);
+    int component1, component2;
+    bool connected;
+
+    for (int edge = firstEdge; edge < sizeCG(enumerator->cg) && getNumSets(enumerator->contraction) > 1; edge++)
+    {
+        getEdgeComponents(enumerator->cg, edge, &component1, &component2);
+        mergeSets(enumerator->contraction, component1, component2);
+    }
+    connected = getNumSets(enumerator->contraction) == 1;
+    undoMerges(enumerator->contraction, numMerges);
+    return connected;
+}
+
+/**
+ * @brief Enumerates the spanning trees extending the current partial tree with edges from @p edge on. Stops each
+ * branch when the partial tree has enumerator->numVisitedEdges edges, so that the partial trees visited are then the
+ * smallest edges of the spanning trees.
+ *
+ * @param enumerator An enumerator, recording the merges of its contraction.
+ * @param edge The next edge to contract or delete.
+ * @param visit The function called on each tree.
+ * @param data Passed to @p visit.
+ * @return true If all the trees have been visited.
+ * @return false If @p visit stopped the enumeration.
+ * @pre The partial tree together with the edges from @p edge on connect the ComponentGraph.
+ */
+static bool extendTree(SpanningTreeEnumerator enumerator, int edge, SpanningTreeVisitor visit, void *data)
+{
+    int numMerges;
+    int component1, component2;
+
+    // Contracting an edge never disconnects the graph, and an edge is only deleted if the graph stays connected, so
+    // the edges are not exhausted before the tree is complete.
+    while (enumerator->numTreeEdges < enumerator->numVisitedEdges)
+    {
+        getEdgeComponents(enumerator->cg, edge, &component1, &component2);
+        numMerges = getNumRecordedMerges(enumerator->contraction);
+        if (mergeSets(enumerator->contraction, component1, component2))
+        {
+            enumerator->treeEdges[enumerator->numTreeEdges++] = edge;
+            bool completed = extendTree(enumerator, edge + 1, visit, data);
+            enumerator->numTreeEdges--;
+            undoMerges(enumerator->contraction, numMerges);
+            if (!completed)
+                return false;
+            if (!isConnectedFrom(enumerator, edge + 1))
+                return true;
+        }
+        edge++;
+    }
+    return visit(enumerator->treeEdges, enumerator->numTreeEdges, data);
+}
+
+/**
+ * @brief Empties the partial tree of an enumerator.
+ *
+ * @param enumerator An enumerator.
+ */
+static void resetTree(SpanningTreeEnumerator enumerator)
+{
+    resetUnionFind(enumerator->contraction);
+    startRecordingMerges(enumerator->contraction);
+    enumerator->numTreeEdges = 0;
+}
+
+/**
+ * @brief SpanningTreeVisitor adding a group to SpanningTreeGroups.
+ *
+ * @param treeEdges The smallest edges of the trees of the group.
+ * @param numEdges The number of edges of @p treeEdges.
+ * @param data The SpanningTreeGroups.
+ * @return true To continue.
+ */
+static bool addGroup(const int *treeEdges, int numEdges, void *data)
+{
+    SpanningTreeGroups *groups = (SpanningTreeGroups *)data;
+
+    if (groups->numGroups == groups->capacity)
+    {
+        groups->capacity *= 2;
+        groups->prefixes = (int *)realloc(groups->prefixes, groups->capacity * numEdges * sizeof(int));
+    }
+    memcpy(groups->prefixes + groups->numGroups * numEdges, treeEdges, numEdges * sizeof(int));
+    groups->numGroups++;
+    return true;
+}
+
+int splitSpanningTrees(SpanningTreeEnumerator enumerator, int minGroups, int **prefixes, int *prefixLength)
+{
+    SpanningTreeGroups groups;
+
+    groups.capacity = minGroups > 0 ? minGroups : 1;
+    groups.prefixes = NULL;
+    groups.numEdges = 0;
+    resetTree(enumerator);
+    groups.numGroups = isConnectedFrom(enumerator, 0) ? 1 : 0;
+
+    // Each additional edge splits the groups further. The first groups are far from having the same size, but there
+    // are then many more of them than needed.
+    while (groups.numGroups > 0 && groups.numGroups < minGroups && groups.numEdges < orderCG(enumerator->cg) - 1)
+    {
+        groups.numEdges++;
+        groups.numGroups = 0;
+        groups.prefixes = (int *)realloc(groups.prefixes, groups.capacity * groups.numEdges * sizeof(int));
+        enumerator->numVisitedEdges = groups.numEdges;
+        resetTree(enumerator);
+        extendTree(enumerator, 0, addGroup, &groups);
+    }
+    enumerator->numVisitedEdges = orderCG(enumerator->cg) - 1;
+
+    *prefixes = groups.prefixes;
+    *prefixLength = groups.numEdges;
+    return groups.numGroups;
+}
+
+bool enumerateSpanningTrees(SpanningTreeEnumerator enumerator, const int *prefix, int prefixLength,
+                            SpanningTreeVisitor visit, void *data)
+{
+    int component1, component2;
+    int edge = 0;
+
+    resetTree(enumerator);
+    for (int i = 0; i < prefixLength; i++)
+    {
+        getEdgeComponents(enumerator->cg, prefix[i], &component1, &component2);
+        mergeSets(enumerator->contraction, component1, component2);
+        enumerator->treeEdges[enumerator->numTreeEdges++] = prefix[i];
+        edge = prefix[i] + 1;
+    }
+    if (!isConnectedFrom(enumerator, edge))
+        return true;
+    return extendTree(enumerator, edge, visit, data);
+}
@@ -0,0 +1,83 @@
+/**
+ * @file SpanningTreeEnumerator.h
+ * @brief Enumeration of the spanning trees of a ComponentGraph, by contraction and deletion of its edges: each edge is
+ * either contracted (added to the tree) or deleted, and deleting an edge is only tried if the remaining graph stays
+ * connected. Every branch of the search thus ends on a spanning tree.
+ * @version 1
+ * @date 2026-10-16
+ *
+ * @copyright Creative Commons.
+ *
+ */
+#ifndef COCA_SPANNINGTREEENUMERATOR_H
+#define COCA_SPANNINGTREEENUMERATOR_H
+
+#include <stdbool.h>
+
+#include "ComponentGraph.h"
+
+/**
+ * @brief The state of an enumeration of spanning trees. An enumerator only reads its ComponentGraph, so several
+ * enumerators over the same ComponentGraph can be used by different threads.
+ */
+typedef struct SpanningTreeEnumerator_s *SpanningTreeEnumerator;
+
+/**
+ * @brief Called on each spanning tree found.
+ *
+ * @param treeEdges The edges of the tree (in increasing order), as edges of the ComponentGraph.
+ * @param numEdges The number of edges of the tree, i.e., the order of the ComponentGraph minus one.
+ * @param data The data given to enumerateSpanningTrees.
+ * @return true To continue the enumeration.
+ * @return false To stop it.
+ */
+typedef bool (*SpanningTreeVisitor)(const int *treeEdges, int numEdges, void *data);
+
+/**
+ * @brief Creates an enumerator of the spanning trees of @p cg.
+ *
+ * @param cg A ComponentGraph. Must not be freed before the enumerator.
+ * @return SpanningTreeEnumerator The enumerator. Must be freed with deleteSpanningTreeEnumerator.
+ */
+SpanningTreeEnumerator createSpanningTreeEnumerator(const ComponentGraph cg);
+
+/**
+ * @brief Frees an enumerator (but not its ComponentGraph).
+ *
+ * @param enumerator An enumerator.
+ */
+void deleteSpanningTreeEnumerator(SpanningTreeEnumerator enumerator);
+
+/**
+ * @brief Splits the spanning trees in groups, so that they can be enumerated in parallel: the group of a tree is given by
+ * its @p prefixLength smallest edges. The smallest number of edges giving at least @p minGroups groups is used (all the
+ * edges of a tree if there are fewer trees), so that the groups are small enough to balance the work between threads.
+ *
+ * @param enumerator An enumerator.
+ * @param minGroups The number of groups wanted.
+ * @param prefixes Will contain the smallest edges of the trees of each group (in increasing order), the ones of group i
+ * being (*prefixes)[i * *prefixLength] to (*prefixes)[(i + 1) * *prefixLength - 1]. Must be freed.
+ * @param prefixLength Will contain the number of edges identifying a group, 0 if @p minGroups is at most 1 (a single
+ * group of all the trees).
+ * @return int The number of groups, 0 if there is no spanning tree.
+ */
+int splitSpanningTrees(SpanningTreeEnumerator enumerator, int minGroups, int **prefixes, int *prefixLength);
+
+/**
+ * @brief Calls @p visit on each spanning tree whose @p prefixLength smallest edges are the ones of @p prefix, a group
+ * given by splitSpanningTrees. The calls for different groups can be run in parallel with different enumerators, and
+ * calling this function for every group enumerates each spanning tree exactly once.
+ *
+ * @param enumerator An enumerator.
+ * @param prefix The smallest edges of the trees, in increasing order. Can be NULL if @p prefixLength is 0.
+ * @param prefixLength The number of edges of @p prefix, 0 to enumerate all the spanning trees.
+ * @param visit The function called on each tree.
+ * @param data Passed to @p visit.
+ * @return true If all the trees have been visited.
+ * @return false If @p visit stopped the enumeration.
+ * @pre The edges of @p prefix are a group given by splitSpanningTrees.
+ */
+bool enumerateSpanningTrees(SpanningTreeEnumerator enumerator, const int *prefix, int prefixLength,
+                            SpanningTreeVisitor visit, void *data);
+
+#endif
@@ -0,0 +1,129 @@
+#include "UnionFind.h"
+#include <stdlib.h>
+
+struct UnionFind_s
+{
+    int numElements; ///< The number of elements.
+    int numSets;     ///< The number of disjoint sets.
+    int *parent;     ///< The parent of each element in the forest, an element being its own parent if it is a representative.
+    int *rank;       ///< An upper bound on the height of the tree rooted in each representative.
+    bool recording;  ///< True if merges are recorded (and path compression disabled).
+    int numRecorded; ///< The number of recorded merges.
+    int *mergedRoot; ///< For each recorded merge, the representative that was attached below the other one.
+    bool *rankGrew;  ///< For each recorded merge, true if the rank of the new representative was increased.
+};
+
+UnionFind createUnionFind(int numElements)
+{
+    UnionFind uf = (UnionFind)malloc(sizeof(*uf));
+    uf->numElements = numElements;
+    uf->parent = (int *)malloc(numElements * sizeof(int));
+    uf->rank = (int *)malloc(numElements * sizeof(int));
+    // A partition of n elements can be merged at most n - 1 times.
+    uf->mergedRoot = (int *)malloc((numElements + 1) * sizeof(int));
+    uf->rankGrew = (bool *)malloc((numElements + 1) * sizeof(bool));
+    uf->recording = false;
+    resetUnionFind(uf);
+    return uf;
+}
+
+void deleteUnionFind(UnionFind uf)
+{
+    free(uf->parent);
+    free(uf->rank);
+    free(uf->mergedRoot);
+    free(uf->rankGrew);
+    free(uf);
+}
+
+void resetUnionFind(UnionFind uf)
+{
+    for (int i = 0; i < uf->numElements; i++)
+    {
+        uf->parent[i] = i;
+        uf->rank[i] = 0;
+    }
+    uf->numSets = uf->numElements;
+    uf->numRecorded = 0;
+}
+
+int findRepresentative(UnionFind uf, int element)
+{
+    int root = element;
+    while (uf->parent[root] != root)
+        root = uf->parent[root];
+    if (uf->recording)
+        return root;
+
+    // Path compression, done iteratively so that long chains cannot overflow the stack.
+    while (uf->parent[element] != root)
+    {
+        int next = uf->parent[element];
+        uf->parent[element] = root;
+        element = next;
+    }
+    return root;
+}
+
+bool mergeSets(UnionFind uf, int element1, int element2)
+{
+    int root1 = findRepresentative(uf, element1);
+    int root2 = findRepresentative(uf, element2);
+    if (root1 == root2)
+        return false;
+
+    if (uf->rank[root1] < uf->rank[root2])
+    {
+        int tmp = root1;
+        root1 = root2;
+        root2 = tmp;
+    }
+    uf->parent[root2] = root1;
+    bool rankGrew = uf->rank[root1] == uf->rank[root2];
+    if (rankGrew)
+        uf->rank[root1]++;
+    uf->numSets--;
+    if (uf->recording)
+    {
+        uf->mergedRoot[uf->numRecorded] = root2;
+        uf->rankGrew[uf->numRecorded] = rankGrew;
+        uf->numRecorded++;
+    }
+    return true;
+}
+
+int getNumSets(UnionFind uf)
+{
+    return uf->numSets;
+}
+
+void startRecordingMerges(UnionFind uf)
+{
+    uf->recording = true;
+    uf->numRecorded = 0;
+}
+
+void stopRecordingMerges(UnionFind uf)
+{
+    uf->recording = false;
+    uf->numRecorded = 0;
+}
+
+int getNumRecordedMerges(UnionFind uf)
+{
+    return uf->numRecorded;
+}
+
+void undoMerges(UnionFind uf, int numMerges)
+{
+    while (uf->numRecorded > numMerges)
+    {
+        uf->numRecorded--;
+        int child = uf->mergedRoot[uf->numRecorded];
+        int root = uf->parent[child];
+        if (uf->rankGrew[uf->numRecorded])
+            uf->rank[root]--;
+        uf->parent[child] = child;
+        uf->numSets++;
+    }
+}
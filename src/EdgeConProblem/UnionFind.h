@@ -0,0 +1,107 @@
+/**
+ * @file UnionFind.h
+ * @brief Disjoint-set forest (union by rank and path compression) over the integers 0..n-1. Merges can be recorded
+ * so that they can be undone in reverse order.
+ * @version 1
+ * @date 2026-10-16
+ *
+ * @copyright Creative Commons.
+ *
+ */
+
+#ifndef COCA_UNIONFIND_H
+#define COCA_UNIONFIND_H
+
+#include <stdbool.h>
+
+/**
+ * @brief A partition of {0,...,n-1} into disjoint sets, each identified by a representative element.
+ */
+typedef struct UnionFind_s *UnionFind;
+
+/**
+ * @brief Creates a partition of {0,...,@p numElements - 1} into singletons.
+ *
+ * @param numElements The number of elements.
+ * @return UnionFind The partition. Must be freed with deleteUnionFind.
+ */
+UnionFind createUnionFind(int numElements);
+
+/**
+ * @brief Frees a partition.
+ *
+ * @param uf A partition.
+ */
+void deleteUnionFind(UnionFind uf);
+
+/**
+ * @brief Resets @p uf to a partition into singletons.
+ *
+ * @param uf A partition.
+ */
+void resetUnionFind(UnionFind uf);
+
+/**
+ * @brief Returns the representative of the set containing @p element.
+ *
+ * @param uf A partition.
+ * @param element An element.
+ * @return int The representative of the set of @p element.
+ * @pre 0 <= @p element < number of elements of @p uf.
+ */
+int findRepresentative(UnionFind uf, int element);
+
+/**
+ * @brief Merges the sets containing @p element1 and @p element2.
+ *
+ * @param uf A partition.
+ * @param element1 An element.
+ * @param element2 An element.
+ * @return true If the two sets were distinct and have been merged.
+ * @return false If @p element1 and @p element2 were already in the same set.
+ */
+bool mergeSets(UnionFind uf, int element1, int element2);
+
+/**
+ * @brief Starts recording the merges of @p uf so that they can be undone with undoMerges. Path compression is
+ * disabled while recording (finding a representative is then logarithmic), since it would modify the forest in a
+ * way that cannot be undone. Forgets previously recorded merges.
+ *
+ * @param uf A partition.
+ */
+void startRecordingMerges(UnionFind uf);
+
+/**
+ * @brief Stops recording merges and forgets the recorded ones (they can no longer be undone). Path compression is
+ * enabled again.
+ *
+ * @param uf A partition.
+ */
+void stopRecordingMerges(UnionFind uf);
+
+/**
+ * @brief Returns the number of merges recorded since the last call to startRecordingMerges (and not undone).
+ *
+ * @param uf A partition.
+ * @return int The number of recorded merges.
+ */
+int getNumRecordedMerges(UnionFind uf);
+
+/**
+ * @brief Undoes the last recorded merges, in reverse order, until only @p numMerges recorded merges remain.
+ *
+ * @param uf A partition recording its merges.
+ * @param numMerges A number of merges, as returned by getNumRecordedMerges before the merges to undo.
+ * @pre @p numMerges <= getNumRecordedMerges(@p uf).
+ */
+void undoMerges(UnionFind uf, int numMerges);
+
+/**
+ * @brief Returns the number of sets of @p uf.
+ *
+ * @param uf A partition.
+ * @return int The number of sets.
+ */
+int getNumSets(UnionFind uf);
+
+#endif
@@ -0,0 +1,89 @@
+/**
+ * @file Bitset.c
+ * @brief  Sets of integers packed in 64-bit words, and square bit matrices made of such sets (one per row).
+ * @version 1
+ * @date 2026-10-16
+ *
+ * @copyright Creative Commons.
+ *
+ */
+
+#include "Bitset.h"
+#include <stdlib.h>
+#include <string.h>
+
+int numWordsOfBitset(int numBits)
+{
+    return (numBits + BITSET_WORD_BITS - 1) / BITSET_WORD_BITS;
+}
+
+uint64_t *createBitset(int numBits)
+{
+    return createBitMatrix(1, numBits);
+}
+
+uint64_t *createBitMatrix(int numRows, int numBits)
+{
+    size_t numWords = (size_t)numRows * numWordsOfBitset(numBits);
+    // calloc(0) may return NULL, which would be mistaken for a failure by callers.
+    return (uint64_t *)calloc(numWords > 0 ? numWords : 1, sizeof(uint64_t));
+}
+
+void deleteBitset(uint64_t *set)
+{
+    free(set);
+}
+
+void clearBitset(uint64_t *set, int numWords)
+{
+    memset(set, 0, numWords * sizeof(uint64_t));
+}
+
+int countBits(const uint64_t *set, int numWords)
+{
+    int result = 0;
+    for (int i = 0; i < numWords; i++)
+        result += __builtin_popcountll(set[i]);
+    return result;
+}
+
+int countBitsFrom(const uint64_t *set, int numWords, int from)
+{
+    int word = from / BITSET_WORD_BITS;
+    if (word >= numWords)
+        return 0;
+    int result = __builtin_popcountll(set[word] & (~(uint64_t)0 << (from % BITSET_WORD_BITS)));
+    return result + countBits(set + word + 1, numWords - word - 1);
+}
+
+int nextSetBit(const uint64_t *set, int numWords, int from)
+{
+    int word = from / BITSET_WORD_BITS;
+    if (word >= numWords)
+        return -1;
+    uint64_t current = set[word] & (~(uint64_t)0 << (from % BITSET_WORD_BITS));
+    while (current == 0)
+    {
+        if (++word >= numWords)
+            return -1;
+        current = set[word];
+    }
+    return word * BITSET_WORD_BITS + __builtin_ctzll(current);
+}
+
+int nextUnsetBit(const uint64_t *set, int numBits, int from)
+{
+    int numWords = numWordsOfBitset(numBits);
+    int word = from / BITSET_WORD_BITS;
+    if (word >= numWords)
+        return -1;
+    uint64_t current = ~set[word] & (~(uint64_t)0 << (from % BITSET_WORD_BITS));
+    while (current == 0)
+    {
+        if (++word >= numWords)
+            return -1;
+        current = ~set[word];
+    }
+    int result = word * BITSET_WORD_BITS + __builtin_ctzll(current);
+    return result < numBits ? result : -1;
+}
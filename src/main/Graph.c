@@ -13,9 +13,72 @@
 
 
 #include "Graph.h"
+#include "Bitset.h"
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/// The first bytes of a binary graph file.
+#define GRAPH_BINARY_MAGIC "COCAGRF"
+
+/// The version of the binary graph format, to increase whenever its layout changes.
+#define GRAPH_BINARY_VERSION 1
+
+_Static_assert(sizeof(bool) == 1, "the initial and final arrays of a binary graph file are used in place as bool arrays");
+
+/**
+ * @brief The header of a binary graph file. It is followed by the sections of GraphBinarySection, in this order, each one starting at a multiple of 8 bytes.
+ */
+typedef struct {
+	char magic[8];			///< GRAPH_BINARY_MAGIC.
+	uint32_t version;		///< GRAPH_BINARY_VERSION.
+	int32_t numNodes;		///< The number of nodes.
+	int32_t numEdges;		///< The number of edges.
+	int32_t numColor;		///< The number of colors.
+	int32_t numNeighbours;	///< The size of the neighbours of the compressed adjacency.
+	uint32_t stringsSize;	///< The size of the string table.
+} GraphBinaryHeader;
+
+/**
+ * @brief The sections of a binary graph file.
+ */
+typedef enum {
+	SECTION_OFFSETS,	///< neighbourOffsets: numNodes+1 int32_t.
+	SECTION_NEIGHBOURS,	///< neighbours: numNeighbours int32_t.
+	SECTION_COLOR,		///< color: numNodes int32_t.
+	SECTION_NAMES,		///< The offsets in the string table of the names of the nodes, then of the colors: numNodes+numColor uint32_t.
+	SECTION_INITIAL,	///< initial: numNodes bytes.
+	SECTION_FINAL,		///< final: numNodes bytes.
+	SECTION_STRINGS,	///< The string table: stringsSize characters, each name being terminated by '\0'.
+	NUM_SECTIONS
+} GraphBinarySection;
+
+/**
+ * @brief Computes where the sections of a binary graph file start.
+ * 
+ * @param header The header of the file.
+ * @param offsets Will contain the offset of each section, and the size of the file at index NUM_SECTIONS.
+ */
+static void computeSectionOffsets(const GraphBinaryHeader *header, size_t offsets[NUM_SECTIONS+1]){
+	size_t sizes[NUM_SECTIONS];
+	sizes[SECTION_OFFSETS] = ((size_t)header->numNodes+1)*sizeof(int32_t);
+	sizes[SECTION_NEIGHBOURS] = (size_t)header->numNeighbours*sizeof(int32_t);
+	sizes[SECTION_COLOR] = (size_t)header->numNodes*sizeof(int32_t);
+	sizes[SECTION_NAMES] = ((size_t)header->numNodes+header->numColor)*sizeof(uint32_t);
+	sizes[SECTION_INITIAL] = (size_t)header->numNodes;
+	sizes[SECTION_FINAL] = (size_t)header->numNodes;
+	sizes[SECTION_STRINGS] = header->stringsSize;
+
+	offsets[0] = sizeof(GraphBinaryHeader);
+	for(int section = 0; section < NUM_SECTIONS; section++){
+		offsets[section+1] = (offsets[section]+sizes[section]+7) & ~(size_t)7;
+	}
+}
 
 void printGraph(Graph graph){
 	//Colors
@@ -40,7 +103,7 @@ void printGraph(Graph graph){
 	printf("\nEdges:\n");
 	for(int i = 0; i<graph.numNodes;i++){
 		for(int j = 0; j<graph.numNodes;j++){
-			printf("%d ",graph.edges[i*graph.numNodes+j]);
+			printf("%d ",isEdge(graph,i,j));
 		}
 		printf("\n");
 	}
@@ -48,23 +111,36 @@ void printGraph(Graph graph){
 
 Graph copyGraph(Graph graph){
 	Graph copy;
+	copy.mapping = NULL;
+	copy.mappingSize = 0;
 	copy.numNodes = graph.numNodes;
 	copy.numEdges = graph.numEdges;
+	size_t namesSize = 0;
+	for(int i = 0; i < graph.numNodes; i++) namesSize += strlen(graph.nodes[i])+1;
+	for(int i = 0; i < graph.numColor; i++) namesSize += strlen(graph.colorNames[i])+1;
+	copy.names = (char*)malloc(namesSize*sizeof(char));
+	char *nextName = copy.names;
 	copy.nodes = (char**)malloc(copy.numNodes*sizeof(char*));
 	copy.color = (int*)malloc(copy.numNodes*sizeof(int));
 	for(int i = 0; i < copy.numNodes; i++){
-		copy.nodes[i] = (char*)malloc(strlen(graph.nodes[i])*sizeof(char));
+		copy.nodes[i] = nextName;
 		strcpy(copy.nodes[i],graph.nodes[i]);
+		nextName += strlen(graph.nodes[i])+1;
 		copy.color[i] = graph.color[i];
 	}
-	copy.edges = (bool*)malloc(copy.numNodes*copy.numNodes*sizeof(bool));
-
-	for(int i = 0; i < copy.numNodes*copy.numNodes; i++) copy.edges[i] = graph.edges[i];
+	int numWords = numWordsOfBitset(copy.numNodes);
+	copy.edges = createBitMatrix(copy.numNodes,copy.numNodes);
+	memcpy(copy.edges,graph.edges,(size_t)copy.numNodes*numWords*sizeof(uint64_t));
+	copy.neighbourOffsets = (int*)malloc((copy.numNodes+1)*sizeof(int));
+	memcpy(copy.neighbourOffsets,graph.neighbourOffsets,(copy.numNodes+1)*sizeof(int));
+	copy.neighbours = (int*)malloc(graph.neighbourOffsets[graph.numNodes]*sizeof(int));
+	memcpy(copy.neighbours,graph.neighbours,graph.neighbourOffsets[graph.numNodes]*sizeof(int));
 	copy.numColor = graph.numColor;
 	copy.colorNames = (char**)malloc(copy.numColor*sizeof(char*));
 	for(int i = 0; i < copy.numColor; i++){
-		copy.colorNames[i] = (char*)malloc(strlen(graph.colorNames[i])*sizeof(char));
+		copy.colorNames[i] = nextName;
 		strcpy(copy.colorNames[i],graph.colorNames[i]);
+		nextName += strlen(graph.colorNames[i])+1;
 	}
 
 	copy.initial = (bool*)malloc(copy.numNodes*sizeof(bool));
@@ -75,28 +151,203 @@ Graph copyGraph(Graph graph){
 }
 
 void deleteGraph(Graph graph){
-	if(graph.edges!=NULL) free(graph.edges);
-	if(graph.nodes!=NULL){
-		for(int i = 0; i<graph.numNodes; i++) {
-			if(graph.nodes[i]!=NULL) free(graph.nodes[i]);
-		}
-		free(graph.nodes);
+	if(graph.edges!=NULL) deleteBitset(graph.edges);
+	if(graph.nodes!=NULL) free(graph.nodes);
+	if(graph.colorNames != NULL) free(graph.colorNames);
+	graph.numEdges=0;
+	graph.numNodes=0;
+
+	//The other arrays of a graph loaded from a binary file are in its mapping.
+	if(graph.mapping!=NULL){
+		munmap(graph.mapping,graph.mappingSize);
+		return;
 	}
+
+	if(graph.neighbourOffsets!=NULL) free(graph.neighbourOffsets);
+	if(graph.neighbours!=NULL) free(graph.neighbours);
+	if(graph.names!=NULL) free(graph.names);
 	//Pour les automates.
 	if(graph.initial!=NULL) free(graph.initial);
 	if(graph.final!=NULL) free(graph.final);
 
 	//Couleurs
 	if(graph.color != NULL) free(graph.color);
-	
-	if(graph.colorNames != NULL){
-		for(int i = 0; i<graph.numColor; i++){
-			if(graph.colorNames[i]!=NULL) free(graph.colorNames[i]);
+}
+
+bool saveGraphBinary(Graph graph, const char *fileName){
+	GraphBinaryHeader header;
+	size_t offsets[NUM_SECTIONS+1];
+	memset(&header,0,sizeof(header));
+	memcpy(header.magic,GRAPH_BINARY_MAGIC,sizeof(GRAPH_BINARY_MAGIC));
+	header.version = GRAPH_BINARY_VERSION;
+	header.numNodes = graph.numNodes;
+	header.numEdges = graph.numEdges;
+	header.numColor = graph.numColor;
+	header.numNeighbours = graph.neighbourOffsets[graph.numNodes];
+	size_t stringsSize = 0;
+	for(int i = 0; i < graph.numNodes; i++) stringsSize += strlen(graph.nodes[i])+1;
+	for(int i = 0; i < graph.numColor; i++) stringsSize += strlen(graph.colorNames[i])+1;
+	header.stringsSize = stringsSize;
+	computeSectionOffsets(&header,offsets);
+
+	//The file is built in memory, the padding between sections being zeroed, and written at once.
+	char *content = (char*)calloc(offsets[NUM_SECTIONS],sizeof(char));
+	memcpy(content,&header,sizeof(header));
+	memcpy(content+offsets[SECTION_OFFSETS],graph.neighbourOffsets,(graph.numNodes+1)*sizeof(int32_t));
+	memcpy(content+offsets[SECTION_NEIGHBOURS],graph.neighbours,header.numNeighbours*sizeof(int32_t));
+	memcpy(content+offsets[SECTION_COLOR],graph.color,graph.numNodes*sizeof(int32_t));
+	memcpy(content+offsets[SECTION_INITIAL],graph.initial,graph.numNodes);
+	memcpy(content+offsets[SECTION_FINAL],graph.final,graph.numNodes);
+	uint32_t *nameOffsets = (uint32_t*)(content+offsets[SECTION_NAMES]);
+	char *strings = content+offsets[SECTION_STRINGS];
+	size_t next = 0;
+	for(int i = 0; i < graph.numNodes+graph.numColor; i++){
+		const char *name = i < graph.numNodes ? graph.nodes[i] : graph.colorNames[i-graph.numNodes];
+		nameOffsets[i] = next;
+		strcpy(strings+next,name);
+		next += strlen(name)+1;
+	}
+
+	FILE *file = fopen(fileName,"wb");
+	if(file == NULL){
+		fprintf(stderr,"Could not write %s: %s\n",fileName,strerror(errno));
+		free(content);
+		return false;
+	}
+	bool written = fwrite(content,1,offsets[NUM_SECTIONS],file) == offsets[NUM_SECTIONS];
+	written = fclose(file) == 0 && written;
+	if(!written) fprintf(stderr,"Could not write %s: %s\n",fileName,strerror(errno));
+	free(content);
+	return written;
+}
+
+/**
+ * @brief Tells if a node is in a sorted list of neighbours of a binary graph file.
+ * 
+ * @param neighbourOffsets The offsets of the lists of neighbours.
+ * @param neighbours The lists of neighbours.
+ * @param node The node whose list is searched.
+ * @param neighbour The node to search.
+ * @return true If @p neighbour is a neighbour of @p node.
+ */
+static bool hasNeighbourInBinary(const int32_t *neighbourOffsets, const int32_t *neighbours, int node, int neighbour){
+	int low = neighbourOffsets[node], high = neighbourOffsets[node+1];
+	while(low < high){
+		int middle = low+(high-low)/2;
+		if(neighbours[middle] < neighbour) low = middle+1;
+		else high = middle;
+	}
+	return low < neighbourOffsets[node+1] && neighbours[low] == neighbour;
+}
+
+/**
+ * @brief Checks that the arrays of a binary graph file are consistent, so that a corrupted file cannot make the program read out of them.
+ *        The lists of neighbours must be sorted without repetition, as computeNeighbours makes them, and the number of edges must match them:
+ *        either the lists are symmetric and each edge but the loops is in two lists (undirected graph), or each edge is in one list (directed graph).
+ * 
+ * @param header The header of the file.
+ * @param content The content of the file.
+ * @param offsets The offsets of its sections.
+ * @return true If the arrays are consistent.
+ */
+static bool checkGraphBinary(const GraphBinaryHeader *header, const char *content, const size_t offsets[NUM_SECTIONS+1]){
+	const int32_t *neighbourOffsets = (const int32_t*)(content+offsets[SECTION_OFFSETS]);
+	const int32_t *neighbours = (const int32_t*)(content+offsets[SECTION_NEIGHBOURS]);
+	const int32_t *color = (const int32_t*)(content+offsets[SECTION_COLOR]);
+	const uint32_t *nameOffsets = (const uint32_t*)(content+offsets[SECTION_NAMES]);
+	const char *strings = content+offsets[SECTION_STRINGS];
+
+	if(neighbourOffsets[0] != 0 || neighbourOffsets[header->numNodes] != header->numNeighbours) return false;
+	for(int i = 0; i < header->numNodes; i++){
+		if(neighbourOffsets[i] > neighbourOffsets[i+1]) return false;
+		if(color[i] < 0 || color[i] >= header->numColor) return false;
+	}
+	for(int i = 0; i < header->numNeighbours; i++){
+		if(neighbours[i] < 0 || neighbours[i] >= header->numNodes) return false;
+	}
+	int numLoops = 0;
+	bool symmetric = true;
+	for(int node = 0; node < header->numNodes; node++){
+		for(int i = neighbourOffsets[node]; i < neighbourOffsets[node+1]; i++){
+			if(i > neighbourOffsets[node] && neighbours[i-1] >= neighbours[i]) return false;
+			if(neighbours[i] == node) numLoops++;
+			else if(symmetric && !hasNeighbourInBinary(neighbourOffsets,neighbours,neighbours[i],node)) symmetric = false;
 		}
-		free(graph.colorNames);
 	}
-	graph.numEdges=0;
-	graph.numNodes=0;
+	if(header->numEdges != header->numNeighbours && !(symmetric && 2*(int64_t)header->numEdges == (int64_t)header->numNeighbours+numLoops)) return false;
+	if(header->stringsSize == 0) return header->numNodes+header->numColor == 0;
+	if(strings[header->stringsSize-1] != '\0') return false;
+	for(int i = 0; i < header->numNodes+header->numColor; i++){
+		if(nameOffsets[i] >= header->stringsSize) return false;
+	}
+	return true;
+}
+
+bool loadGraphBinary(const char *fileName, Graph *graph){
+	int fd = open(fileName,O_RDONLY);
+	if(fd == -1){
+		fprintf(stderr,"Could not read %s: %s\n",fileName,strerror(errno));
+		return false;
+	}
+	struct stat info;
+	if(fstat(fd,&info) != 0 || (size_t)info.st_size < sizeof(GraphBinaryHeader)){
+		fprintf(stderr,"%s is not a binary graph file.\n",fileName);
+		close(fd);
+		return false;
+	}
+	size_t size = info.st_size;
+	//Private and writable: the graph can be modified without changing the file.
+	char *content = mmap(NULL,size,PROT_READ|PROT_WRITE,MAP_PRIVATE,fd,0);
+	close(fd);
+	if(content == MAP_FAILED){
+		fprintf(stderr,"Could not read %s: %s\n",fileName,strerror(errno));
+		return false;
+	}
+
+	GraphBinaryHeader header;
+	size_t offsets[NUM_SECTIONS+1];
+	memcpy(&header,content,sizeof(header));
+	if(memcmp(header.magic,GRAPH_BINARY_MAGIC,sizeof(GRAPH_BINARY_MAGIC)) != 0 || header.version != GRAPH_BINARY_VERSION){
+		fprintf(stderr,"%s is not a binary graph file of version %d.\n",fileName,GRAPH_BINARY_VERSION);
+		munmap(content,size);
+		return false;
+	}
+	if(header.numNodes < 0 || header.numColor < 0 || header.numNeighbours < 0){
+		fprintf(stderr,"%s is corrupted.\n",fileName);
+		munmap(content,size);
+		return false;
+	}
+	computeSectionOffsets(&header,offsets);
+	if(offsets[NUM_SECTIONS] > size || !checkGraphBinary(&header,content,offsets)){
+		fprintf(stderr,"%s is corrupted.\n",fileName);
+		munmap(content,size);
+		return false;
+	}
+
+	graph->numNodes = header.numNodes;
+	graph->numEdges = header.numEdges;
+	graph->numColor = header.numColor;
+	graph->neighbourOffsets = (int*)(content+offsets[SECTION_OFFSETS]);
+	graph->neighbours = (int*)(content+offsets[SECTION_NEIGHBOURS]);
+	graph->color = (int*)(content+offsets[SECTION_COLOR]);
+	graph->initial = (bool*)(content+offsets[SECTION_INITIAL]);
+	graph->final = (bool*)(content+offsets[SECTION_FINAL]);
+	graph->names = content+offsets[SECTION_STRINGS];
+	graph->mapping = content;
+	graph->mappingSize = size;
+
+	const uint32_t *nameOffsets = (const uint32_t*)(content+offsets[SECTION_NAMES]);
+	graph->nodes = (char**)malloc(graph->numNodes*sizeof(char*));
+	for(int i = 0; i < graph->numNodes; i++) graph->nodes[i] = graph->names+nameOffsets[i];
+	graph->colorNames = (char**)malloc(graph->numColor*sizeof(char*));
+	for(int i = 0; i < graph->numColor; i++) graph->colorNames[i] = graph->names+nameOffsets[graph->numNodes+i];
+
+	graph->edges = createBitMatrix(graph->numNodes,graph->numNodes);
+	for(int node = 0; node < graph->numNodes; node++){
+		uint64_t *row = getNeighbourSet(*graph,node);
+		for(int i = graph->neighbourOffsets[node]; i < graph->neighbourOffsets[node+1]; i++) setBit(row,graph->neighbours[i]);
+	}
+	return true;
 }
 
 int orderG(Graph graph){
@@ -108,7 +359,36 @@ int sizeG(Graph graph){
 }
 
 bool isEdge(Graph graph, int source, int target){
-	return graph.edges[(source*graph.numNodes)+target];
+	return testBit(getNeighbourSet(graph,source),target);
+}
+
+void computeNeighbours(Graph *graph){
+	int n = graph->numNodes;
+	int numWords = numWordsOfBitset(n);
+	graph->neighbourOffsets = (int*)malloc((n+1)*sizeof(int));
+	graph->neighbourOffsets[0] = 0;
+	for(int i = 0; i < n; i++)
+		graph->neighbourOffsets[i+1] = graph->neighbourOffsets[i] + countBits(getNeighbourSet(*graph,i),numWords);
+
+	graph->neighbours = (int*)malloc(graph->neighbourOffsets[n]*sizeof(int));
+	int pos = 0;
+	for(int i = 0; i < n; i++){
+		uint64_t *row = getNeighbourSet(*graph,i);
+		for(int j = nextSetBit(row,numWords,0); j != -1; j = nextSetBit(row,numWords,j+1))
+			graph->neighbours[pos++] = j;
+	}
+}
+
+int degreeG(Graph graph, int node){
+	return graph.neighbourOffsets[node+1] - graph.neighbourOffsets[node];
+}
+
+int* getNeighbours(Graph graph, int node){
+	return graph.neighbours + graph.neighbourOffsets[node];
+}
+
+uint64_t* getNeighbourSet(Graph graph, int node){
+	return getBitsetRow(graph.edges,numWordsOfBitset(graph.numNodes),node);
 }
 
 bool isSource(Graph graph, int node){
@@ -0,0 +1,197 @@
+#include "SatSolver.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+/**
+ * @brief Sets the variables of the literals of @p line in @p assignment, until the terminating 0.
+ *
+ * @param line A line of literals.
+ * @param numVariables The number of variables.
+ * @param assignment The assignment.
+ */
+static void readLiterals(const char *line, int numVariables, bool *assignment)
+{
+    char *end;
+    long literal;
+
+    while (true) {
+        literal = strtol(line, &end, 10);
+        if (end == line || 0 == literal) {
+            return;
+        }
+        if (labs(literal) <= numVariables) {
+            assignment[labs(literal)] = literal > 0;
+        }
+        line = end;
+    }
+}
+
+/**
+ * @brief Reads the answer of a solver from its output in the format of the SAT competition.
+ *
+ * @param output The output of the solver.
+ * @param numVariables The number of variables.
+ * @param assignment The assignment.
+ * @return SatAnswer The answer, SAT_UNKNOWN if there is no "s" line.
+ */
+static SatAnswer readCompetitionOutput(FILE *output, int numVariables, bool *assignment)
+{
+    SatAnswer answer = SAT_UNKNOWN;
+    char *line = NULL;
+    size_t size = 0;
+
+    while (-1 != getline(&line, &size, output)) {
+        if (0 == strncmp(line, "s SATISFIABLE", 13)) {
+            answer = SAT_SATISFIABLE;
+        }
+        else if (0 == strncmp(line, "s UNSATISFIABLE", 15)) {
+            answer = SAT_UNSATISFIABLE;
+        }
+        else if ('v' == line[0]) {
+            readLiterals(line + 1, numVariables, assignment);
+        }
+    }
+    free(line);
+    return answer;
+}
+
+/**
+ * @brief Reads the answer of minisat from its result file: "SAT" followed by the model, "UNSAT" or "INDET".
+ *
+ * @param fileName The name of the result file.
+ * @param numVariables The number of variables.
+ * @param assignment The assignment.
+ * @return SatAnswer The answer, SAT_UNKNOWN if the file cannot be read.
+ */
+static SatAnswer readMinisatResult(const char *fileName, int numVariables, bool *assignment)
+{
+    SatAnswer answer = SAT_UNKNOWN;
+    char *line = NULL;
+    size_t size = 0;
+    FILE *result = fopen(fileName, "r");
+
+    if (NULL == result) {
+        return SAT_UNKNOWN;
+    }
+    if (-1 != getline(&line, &size, result)) {
+        if (0 == strncmp(line, "SAT", 3)) {
+            answer = SAT_SATISFIABLE;
+            while (-1 != getline(&line, &size, result)) {
+                readLiterals(line, numVariables, assignment);
+            }
+        }
+        else if (0 == strncmp(line, "UNSAT", 5)) {
+            answer = SAT_UNSATISFIABLE;
+        }
+    }
+    free(line);
+    fclose(result);
+    return answer;
+}
+
+/**
+ * @brief Runs a solver without a shell, with its standard output going to a pipe.
+ *
+ * @param solver The command running the solver, with its options separated by spaces.
+ * @param fileName The DIMACS file, added as last but one argument if @p resultName is not NULL, as last one otherwise.
+ * @param resultName The result file, added as last argument, or NULL.
+ * @param process Will contain the process of the solver.
+ * @return FILE* The standard output of the solver, or NULL if it cannot be run.
+ */
+static FILE *startSolver(const char *solver, const char *fileName, const char *resultName, pid_t *process)
+{
+    char words[strlen(solver) + 1];
+    char *arguments[strlen(solver) / 2 + 4];
+    int numArguments = 0;
+    int channel[2];
+    FILE *output;
+
+    strcpy(words, solver);
+    for (char *word = strtok(words, " \t"); NULL != word; word = strtok(NULL, " \t")) {
+        arguments[numArguments++] = word;
+    }
+    if (0 == numArguments) {
+        fprintf(stderr, "No solver given.\n");
+        return NULL;
+    }
+    arguments[numArguments++] = (char *)fileName;
+    if (NULL != resultName) {
+        arguments[numArguments++] = (char *)resultName;
+    }
+    arguments[numArguments] = NULL;
+
+    if (-1 == pipe(channel)) {
+        perror("pipe");
+        return NULL;
+    }
+    *process = fork();
+    if (0 == *process) {
+        dup2(channel[1], STDOUT_FILENO);
+        close(channel[0]);
+        close(channel[1]);
+        execvp(arguments[0], arguments);
+        perror(arguments[0]);
+        _exit(127);
+    }
+    close(channel[1]);
+    if (-1 == *process) {
+        perror("fork");
+        close(channel[0]);
+        return NULL;
+    }
+    output = fdopen(channel[0], "r");
+    if (NULL == output) {
+        perror("fdopen");
+        close(channel[0]);
+        waitpid(*process, NULL, 0);
+    }
+    return output;
+}
+
+SatAnswer solveDimacsFile(const char *solver, const char *fileName, int numVariables, bool *assignment)
+{
+    bool isMinisat = NULL != strstr(solver, "minisat");
+    char resultName[] = "/tmp/edgeconXXXXXX.model";
+    SatAnswer answer;
+    FILE *output;
+    pid_t process;
+    int status;
+
+    memset(assignment, 0, (numVariables + 1) * sizeof(bool));
+
+    /* minisat writes its model in a file, created here so that its name cannot be guessed. */
+    if (isMinisat) {
+        int fd = mkstemps(resultName, 6);
+        if (-1 == fd) {
+            perror("mkstemps");
+            return SAT_UNKNOWN;
+        }
+        close(fd);
+    }
+
+    output = startSolver(solver, fileName, isMinisat ? resultName : NULL, &process);
+    if (NULL == output) {
+        if (isMinisat) {
+            remove(resultName);
+        }
+        return SAT_UNKNOWN;
+    }
+    answer = readCompetitionOutput(output, numVariables, assignment);
+    fclose(output);
+
+    if (-1 == waitpid(process, &status, 0) || (WIFEXITED(status) && 127 == WEXITSTATUS(status))) {
+        fprintf(stderr, "Could not run the solver \"%s\".\n", solver);
+        answer = SAT_UNKNOWN;
+    }
+    else if (isMinisat) {
+        answer = readMinisatResult(resultName, numVariables, assignment);
+    }
+    if (isMinisat) {
+        remove(resultName);
+    }
+    return answer;
+}
@@ -1,5 +1,7 @@
 
 #include "Z3Tools.h"
+#include "Bitset.h"
+#include <assert.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdbool.h>
@@ -23,48 +25,179 @@ Z3_ast mk_bool_var(Z3_context ctx, const char * name)
     return mk_var(ctx, name, ty);
 }
 
+/**
+ * @brief The data of a session.
+ */
+struct Z3Session_s
+{
+    Z3_context ctx;   ///< The context of the solver.
+    Z3_solver solver; ///< The solver.
+    Z3_params params; ///< The parameters set on the solver.
+    Z3_model model;   ///< The model of the last check if it answered Z3_L_TRUE, NULL otherwise.
+};
+
+Z3Session createZ3Session(Z3_context ctx)
+{
+    Z3Session session = malloc(sizeof(struct Z3Session_s));
+    assert(NULL != session);
+
+    session->ctx = ctx;
+    session->solver = Z3_mk_solver(ctx);
+    Z3_solver_inc_ref(ctx, session->solver);
+    session->params = Z3_mk_params(ctx);
+    Z3_params_inc_ref(ctx, session->params);
+    session->model = NULL;
+    return session;
+}
+
+/**
+ * @brief Forgets the model of the last check.
+ *
+ * @param session A session.
+ */
+static void releaseModel(Z3Session session)
+{
+    if (NULL != session->model)
+    {
+        Z3_model_dec_ref(session->ctx, session->model);
+        session->model = NULL;
+    }
+}
+
+void deleteZ3Session(Z3Session session)
+{
+    releaseModel(session);
+    Z3_params_dec_ref(session->ctx, session->params);
+    Z3_solver_dec_ref(session->ctx, session->solver);
+    free(session);
+}
+
+Z3_context getZ3SessionContext(Z3Session session)
+{
+    return session->ctx;
+}
+
+Z3_solver getZ3SessionSolver(Z3Session session)
+{
+    return session->solver;
+}
+
+void setZ3SessionUintParameter(Z3Session session, const char *name, unsigned int value)
+{
+    Z3_params_set_uint(session->ctx, session->params, Z3_mk_string_symbol(session->ctx, name), value);
+    Z3_solver_set_params(session->ctx, session->solver, session->params);
+}
+
+void setZ3SessionBoolParameter(Z3Session session, const char *name, bool value)
+{
+    Z3_params_set_bool(session->ctx, session->params, Z3_mk_string_symbol(session->ctx, name), value);
+    Z3_solver_set_params(session->ctx, session->solver, session->params);
+}
+
+void setZ3SessionTimeout(Z3Session session, unsigned int milliseconds)
+{
+    /* 0 means no limit for us, UINT_MAX for Z3. */
+    setZ3SessionUintParameter(session, "timeout", 0 == milliseconds ? (unsigned int)-1 : milliseconds);
+}
+
+void setZ3SessionResourceLimit(Z3Session session, unsigned int limit)
+{
+    setZ3SessionUintParameter(session, "rlimit", limit);
+}
+
+void assertInZ3Session(Z3Session session, Z3_ast formula)
+{
+    Z3_solver_assert(session->ctx, session->solver, formula);
+}
+
+/**
+ * @brief Keeps the model of a check if it answered Z3_L_TRUE.
+ *
+ * @param session A session.
+ * @param result The answer of the check.
+ * @return Z3_lbool @p result.
+ */
+static Z3_lbool keepModel(Z3Session session, Z3_lbool result)
+{
+    if (Z3_L_TRUE == result)
+    {
+        session->model = Z3_solver_get_model(session->ctx, session->solver);
+        if (session->model) Z3_model_inc_ref(session->ctx, session->model);
+    }
+    return result;
+}
+
+Z3_lbool checkZ3Session(Z3Session session)
+{
+    releaseModel(session);
+    return keepModel(session, Z3_solver_check(session->ctx, session->solver));
+}
+
+Z3_lbool checkZ3SessionAssumptions(Z3Session session, int numAssumptions, const Z3_ast *assumptions)
+{
+    releaseModel(session);
+    return keepModel(session, Z3_solver_check_assumptions(session->ctx, session->solver, numAssumptions, assumptions));
+}
+
+Z3_model getZ3SessionModel(Z3Session session)
+{
+    return session->model;
+}
+
+const char *getZ3SessionReasonUnknown(Z3Session session)
+{
+    return Z3_solver_get_reason_unknown(session->ctx, session->solver);
+}
+
+void printZ3SessionStatistics(Z3Session session, FILE *file)
+{
+    Z3_stats statistics = Z3_solver_get_statistics(session->ctx, session->solver);
+
+    Z3_stats_inc_ref(session->ctx, statistics);
+    fprintf(file, "%s\n", Z3_stats_to_string(session->ctx, statistics));
+    Z3_stats_dec_ref(session->ctx, statistics);
+}
+
 Z3_lbool isFormulaSat(Z3_context ctx, Z3_ast formula){
-    Z3_solver s = Z3_mk_solver(ctx);
-    Z3_solver_inc_ref(ctx, s);
-    Z3_solver_assert(ctx,s,formula);
+    Z3Session session = createZ3Session(ctx);
+    assertInZ3Session(session, formula);
 
-    Z3_lbool result =  Z3_solver_check(ctx, s);
-    Z3_solver_dec_ref(ctx, s);
+    Z3_lbool result = checkZ3Session(session);
+    deleteZ3Session(session);
     return result;
 }
 
 Z3_model getModelFromSatFormula(Z3_context ctx, Z3_ast formula){
-    Z3_solver s = Z3_mk_solver(ctx);
-    Z3_solver_inc_ref(ctx, s);
-    Z3_solver_assert(ctx,s,formula);
+    Z3Session session = createZ3Session(ctx);
+    assertInZ3Session(session, formula);
 
     Z3_model m      = 0;
-    Z3_lbool result = Z3_solver_check(ctx, s);
+    Z3_lbool result = checkZ3Session(session);
 
     switch (result) {
     case Z3_L_FALSE:
         fprintf(stderr,"Error: Trying to get a model from an unsat formula.\n");
-        Z3_solver_dec_ref(ctx, s);
+        deleteZ3Session(session);
         exit(1);
     case Z3_L_UNDEF:
         printf("Warning: Getting a partial model from a formula of unknown satisfiability.\n");
+        m = Z3_solver_get_model(ctx, getZ3SessionSolver(session));
         break;
     case Z3_L_TRUE:
+        m = getZ3SessionModel(session);
         break;
     }
 
-    m = Z3_solver_get_model(ctx, s);
     if (m) Z3_model_inc_ref(ctx, m);
-    Z3_solver_dec_ref(ctx, s);
+    deleteZ3Session(session);
     return m;
 }
 
 Z3_lbool solveFormula(Z3_context ctx, Z3_ast formula, Z3_model* model){
-    Z3_solver s = Z3_mk_solver(ctx);
-    Z3_solver_inc_ref(ctx, s);
-    Z3_solver_assert(ctx,s,formula);
+    Z3Session session = createZ3Session(ctx);
+    assertInZ3Session(session, formula);
 
-    Z3_lbool result = Z3_solver_check(ctx, s);
+    Z3_lbool result = checkZ3Session(session);
 
     switch (result) {
     case Z3_L_FALSE:
@@ -74,23 +207,75 @@ Z3_lbool solveFormula(Z3_context ctx, Z3_ast formula, Z3_model* model){
         printf("Warning: Getting a partial model from a formula of unknown satisfiability.\n");
         break;
     case Z3_L_TRUE:
-        *model = Z3_solver_get_model(ctx, s);
+        *model = getZ3SessionModel(session);
         if (*model) Z3_model_inc_ref(ctx, *model);
 
     }
 
-    Z3_solver_dec_ref(ctx, s);
+    deleteZ3Session(session);
     return result;
 }
 
 bool valueOfVarInModel(Z3_context ctx, Z3_model model, Z3_ast variable){
     Z3_ast result;
-    Z3_bool toto = Z3_model_eval(ctx,model,variable,Z3_L_TRUE,&result); 
 
-    if(Z3_mk_true(ctx) == result) return true;
-    if(Z3_mk_false(ctx) == result) return false;
+    if (Z3_model_eval(ctx, model, variable, true, &result))
+    {
+        switch (Z3_get_bool_value(ctx, result))
+        {
+        case Z3_L_TRUE:
+            return true;
+        case Z3_L_FALSE:
+            return false;
+        default:
+            break;
+        }
+    }
 
     fprintf(stderr,"Error: Used on a non-boolean formula, or other unknown error\n");
     exit(1);
 }
 
+void valuesOfVarsInModel(Z3_context ctx, Z3_model model, int numVars, const Z3_ast *vars, uint64_t *values)
+{
+    /* The model is read once, and its constants are found back among the variables by the id of their declaration,
+     * in a hash table with linear probing. */
+    unsigned int numSlots = 1;
+    while (numSlots < 2 * (unsigned int)numVars)
+        numSlots *= 2;
+    unsigned int mask = numSlots - 1;
+    unsigned int *ids = malloc((numVars + 1) * sizeof(unsigned int));
+    int *slots = malloc(numSlots * sizeof(int));
+    assert(NULL != ids && NULL != slots);
+
+    for (unsigned int slot = 0; slot < numSlots; slot++)
+        slots[slot] = -1;
+    for (int i = 0; i < numVars; i++)
+    {
+        ids[i] = Z3_get_ast_id(ctx, Z3_func_decl_to_ast(ctx, Z3_get_app_decl(ctx, Z3_to_app(ctx, vars[i]))));
+        unsigned int slot = (ids[i] * 2654435761u) & mask;
+        while (-1 != slots[slot])
+            slot = (slot + 1) & mask;
+        slots[slot] = i;
+        clearBit(values, i);
+    }
+
+    unsigned int numConsts = Z3_model_get_num_consts(ctx, model);
+    for (unsigned int c = 0; c < numConsts; c++)
+    {
+        Z3_func_decl decl = Z3_model_get_const_decl(ctx, model, c);
+        Z3_ast value = Z3_model_get_const_interp(ctx, model, decl);
+
+        if (NULL == value || Z3_L_TRUE != Z3_get_bool_value(ctx, value))
+            continue;
+        unsigned int id = Z3_get_ast_id(ctx, Z3_func_decl_to_ast(ctx, decl));
+        for (unsigned int slot = (id * 2654435761u) & mask; -1 != slots[slot]; slot = (slot + 1) & mask)
+        {
+            if (ids[slots[slot]] == id)
+                setBit(values, slots[slot]);
+        }
+    }
+
+    free(ids);
+    free(slots);
+}
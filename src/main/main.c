@@ -13,16 +13,23 @@
 #include "Parsing.h"
 #include "EdgeConReduction.h"
 #include "Z3Tools.h"
+#include "SatSolver.h"
 #include "Parser.h"
 #include "EdgeConGraph.h"
 #include "EdgeConResolution.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <limits.h>
 #include <time.h>
 #include <string.h>
 #include <unistd.h>
+#include <getopt.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <signal.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/wait.h>
 
 void printModel(Z3_context ctx, Z3_model model, EdgeConGraph biGraph, int numComponent)
 {
@@ -51,19 +58,287 @@ void printModel(Z3_context ctx, Z3_model model, EdgeConGraph biGraph, int numCom
     printf("\n");
 }
 
+/**
+ * @brief Opens a file to write a formula in, with a large buffer since formulas are written in many small pieces.
+ *
+ * @param name The name of the file.
+ * @param compress If true, the formula goes through gzip before being written in the file.
+ * @param gzip Will contain the process of gzip, or -1 if @p compress is false.
+ * @return FILE* The file, to be closed with closeFormulaFile, or NULL if it cannot be opened.
+ */
+FILE *openFormulaFile(const char *name, bool compress, pid_t *gzip)
+{
+    FILE *file;
+
+    *gzip = -1;
+    if (!compress)
+        file = fopen(name, "w");
+    else
+    {
+        /* gzip is run directly rather than by a shell, so that the name of the file is not interpreted. */
+        int output = open(name, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+        int channel[2];
+        if (-1 == output)
+        {
+            perror(name);
+            return NULL;
+        }
+        if (-1 == pipe(channel))
+        {
+            perror("pipe");
+            close(output);
+            return NULL;
+        }
+        *gzip = fork();
+        if (0 == *gzip)
+        {
+            dup2(channel[0], STDIN_FILENO);
+            dup2(output, STDOUT_FILENO);
+            close(channel[0]);
+            close(channel[1]);
+            close(output);
+            execlp("gzip", "gzip", "-c", (char *)NULL);
+            perror("gzip");
+            _exit(127);
+        }
+        close(channel[0]);
+        close(output);
+        if (-1 == *gzip)
+        {
+            perror("fork");
+            close(channel[1]);
+            return NULL;
+        }
+        /* If gzip stops, writing fails instead of killing the program, and closeFormulaFile reports it. */
+        signal(SIGPIPE, SIG_IGN);
+        file = fdopen(channel[1], "w");
+    }
+
+    if (NULL == file)
+    {
+        perror(name);
+        return NULL;
+    }
+    setvbuf(file, NULL, _IOFBF, 1 << 16);
+    return file;
+}
+
+/**
+ * @brief Closes a file opened with openFormulaFile, and waits for the end of gzip if the formula is compressed.
+ *
+ * @param file The file.
+ * @param gzip The process given by openFormulaFile.
+ * @return true If the whole formula was written.
+ * @return false Otherwise, after an error message.
+ */
+bool closeFormulaFile(FILE *file, pid_t gzip)
+{
+    bool written = !ferror(file);
+    int status;
+
+    if (0 != fclose(file))
+        written = false;
+    if (!written)
+        perror("closeFormulaFile");
+    if (-1 == gzip)
+        return written;
+
+    while (-1 == waitpid(gzip, &status, 0))
+    {
+        if (EINTR != errno)
+        {
+            perror("waitpid");
+            return false;
+        }
+    }
+    if (!WIFEXITED(status) || 0 != WEXITSTATUS(status))
+    {
+        fprintf(stderr, "gzip failed\n");
+        return false;
+    }
+    return written;
+}
+
+/**
+ * @brief Decides the reduction with an external SAT solver, through a temporary DIMACS file.
+ *
+ * @param solver The command running the solver.
+ * @param biGraph The EdgeConGraph.
+ * @param size The cost.
+ * @param getTranslators If the formula is satisfiable, adds the translator set found to @p biGraph.
+ * @return Z3_lbool Z3_L_TRUE if the formula is satisfiable, Z3_L_FALSE if it is not, Z3_L_UNDEF otherwise.
+ */
+Z3_lbool solveWithExternalSolver(const char *solver, EdgeConGraph biGraph, int size, bool getTranslators)
+{
+    char fileName[] = "/tmp/edgeconXXXXXX.cnf";
+    int fd = mkstemps(fileName, 4);
+    if (-1 == fd)
+    {
+        perror("mkstemps");
+        return Z3_L_UNDEF;
+    }
+
+    FILE *file = fdopen(fd, "w");
+    if (NULL == file)
+    {
+        perror("fdopen");
+        close(fd);
+        unlink(fileName);
+        return Z3_L_UNDEF;
+    }
+    int numVariables = EdgeConReductionToDimacs(file, biGraph, size);
+    if (0 != fclose(file) || numVariables < 0)
+    {
+        unlink(fileName);
+        return Z3_L_UNDEF;
+    }
+
+    bool *assignment = malloc((numVariables + 1) * sizeof(bool));
+    if (NULL == assignment)
+    {
+        perror("malloc");
+        unlink(fileName);
+        return Z3_L_UNDEF;
+    }
+    SatAnswer answer = solveDimacsFile(solver, fileName, numVariables, assignment);
+    unlink(fileName);
+
+    if (SAT_SATISFIABLE == answer && getTranslators)
+        getTranslatorSetFromAssignment(assignment, biGraph);
+    free(assignment);
+
+    switch (answer)
+    {
+    case SAT_SATISFIABLE:
+        return Z3_L_TRUE;
+    case SAT_UNSATISFIABLE:
+        return Z3_L_FALSE;
+    default:
+        return Z3_L_UNDEF;
+    }
+}
+
+/**
+ * @brief The options with only a long name.
+ */
+enum
+{
+    OPTION_TIMEOUT = 256, ///< --timeout MS
+    OPTION_RLIMIT,        ///< --rlimit N
+    OPTION_CONVERT        ///< --convert
+};
+
+/**
+ * @brief Reads a non-negative integer option.
+ *
+ * @param text The argument of the option.
+ * @param value Will contain the integer.
+ * @return true If @p text is a non-negative integer fitting in an unsigned int.
+ * @return false Otherwise.
+ */
+bool parseUnsignedOption(const char *text, unsigned int *value)
+{
+    char *end;
+    unsigned long result;
+
+    if ('\0' == *text || '-' == *text)
+        return false;
+    result = strtoul(text, &end, 10);
+    if ('\0' != *end || result > (unsigned int)-1)
+        return false;
+    *value = result;
+    return true;
+}
+
+/**
+ * @brief Creates a solver session with the limits given on the command line.
+ *
+ * @param ctx The context of the solver.
+ * @param timeout The time limit of each check in milliseconds, 0 for none.
+ * @param rlimit The resource limit of each check, 0 for none.
+ * @return Z3Session The session.
+ */
+Z3Session createLimitedSession(Z3_context ctx, unsigned int timeout, unsigned int rlimit)
+{
+    Z3Session session = createZ3Session(ctx);
+
+    if (0 != timeout)
+        setZ3SessionTimeout(session, timeout);
+    if (0 != rlimit)
+        setZ3SessionResourceLimit(session, rlimit);
+    return session;
+}
+
+/**
+ * @brief Returns the time on a monotonic wall clock, to measure durations comparable with --timeout (clock() measures the
+ *        processor time instead, summed over all the threads).
+ *
+ * @return double The time in seconds, from an arbitrary origin.
+ */
+double getWallClockTime()
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Explains why the solver could not decide, with its statistics.
+ *
+ * @param session The session of the solver.
+ */
+void reportUndecided(Z3Session session)
+{
+    printf("The solver gave up: %s.\n", getZ3SessionReasonUnknown(session));
+    printZ3SessionStatistics(session, stdout);
+}
+
+/**
+ * @brief Loads a graph, from a binary file if its name ends with ".cgr" (see saveGraphBinary), from a .dot file otherwise.
+ *        Exits the program if the graph cannot be loaded.
+ *
+ * @param fileName The name of the file.
+ * @return Graph The graph.
+ */
+Graph loadGraph(char *fileName)
+{
+    size_t length = strlen(fileName);
+    Graph graph;
+
+    if (length >= 4 && 0 == strcmp(fileName + length - 4, ".cgr"))
+    {
+        if (!loadGraphBinary(fileName, &graph))
+            exit(EXIT_FAILURE);
+        return graph;
+    }
+    return getGraphFromFile(fileName);
+}
+
 void usage()
 {
     printf("Use: graphProblemSolver [options] file\n");
-    printf(" file should contain a colored graph in dot format.\n The program decides if there exists a translator set for the graph in input.\n Can apply a brute force algorithm or a reduction to SAT. In the latter case, a weight for the expected solution must be given.\n Can display the result both on the command line or in dot format.\n");
+    printf(" file should contain a colored graph in dot format, or in binary format if its name ends with .cgr (see --convert).\n The program decides if there exists a translator set for the graph in input.\n Can apply a brute force algorithm or a reduction to SAT. In the latter case, a weight for the expected solution must be given.\n Can display the result both on the command line or in dot format.\n");
     printf("Options: \n");
     printf(" -h         Displays this help\n");
     printf(" -v         Activate verbose mode (displays parsed graphs)\n");
     printf(" -B         Solves the problem using the brute force algorithm\n");
-    printf(" -R COST    Solves the problem using a reduction and determines if for all possible translator sets, all nodes can communicate with cost at most COST\n");
-    printf(" -F         Displays the formula computed (obviously not in this version, but you should really display it in your code). Only active if -R is active\n");
+    printf(" -b         Solves the problem using the branch and bound algorithm\n");
+    printf(" -j THREADS Number of threads used by the brute force algorithm, from 1 to %d [if not present: 1]. Only has an effect if -B is present\n", MAX_BRUTE_FORCE_THREADS);
+    printf(" -R COST    Solves the problem using a reduction and determines if for all possible translator sets, all nodes can communicate with cost at most COST (a number at least 0)\n");
+    printf(" -R auto    Solves the problem using a reduction and computes the smallest such COST, with a single incremental solver\n");
+    printf(" -A ENCODING Encoding of the \"at most one\" constraints of the reduction: pairwise, sequential, product or pb [if not present: pairwise]. Only has an effect if -R is present\n");
+    printf(" --timeout MS Stops each check of the solver after MS milliseconds, answering that the problem could not be decided [if not present: no limit]. Only has an effect if -R is present and -S is not\n");
+    printf(" --rlimit N Stops each check of the solver after N units of Z3 resources (deterministic, unlike --timeout) [if not present: no limit]. Only has an effect if -R is present and -S is not\n");
+    printf(" -s         Adds symmetry breaking constraints on the numbering of the translators to the reduction. Only has an effect if -R is present\n");
+    printf(" -D FILE    Writes the formula in DIMACS CNF format in FILE (a file or a named pipe). Only active if -R COST is active\n");
+    printf(" -S SOLVER  Solves the formula with the external SAT solver SOLVER (kissat, cadical, minisat...) instead of Z3. Only has an effect with -R COST\n");
+    printf(" -F         Writes the formula computed in SMT-LIB2 format in \"sol/NAME.formula\". Only active if -R COST is active\n");
+    printf(" -z         Compresses the formulas written by -F and -D with gzip (a .gz suffix is added to their names)\n");
     printf(" -t         Displays the translator set found [if not present, only displays the existence of the set].\n");
     printf(" -M         If there is a solution to the reduction, displays the tree obtained over the homogeneous components. Only has an effect if -R is present\n");
     printf(" -f         Writes the result with colors in a .dot file. See next option for the name. These files will be produced in the folder 'sol'.\n");
+    printf(" --convert IN OUT Writes the graph of IN in binary format in OUT, and exits. Name OUT NAME.cgr to load it later without parsing\n");
     printf(" -o NAME    Writes the output graph in \"NAME_Brute.dot\" or \"NAME_SAT.dot\" depending of the algorithm used and the formula in \"NAME.formul\". [if not present: \"result_SAT.dot\", \"result_Brute.dot\" and \"result.formul\"]\n");
 }
 
@@ -80,19 +355,50 @@ int main(int argc, char *argv[])
     bool outputFile = false;
     bool printformula = false;
     bool bruteForce = false;
+    bool branchAndBound = false;
     bool reduction = false;
     bool displayModel = false;
     int size = 0;
+    bool autoCost = false;
+    int numThreads = 1;
     char *solutionName = "default";
+    char *dimacsName = NULL;
+    char *externalSolver = NULL;
+    bool compress = false;
+    unsigned int timeout = 0;
+    unsigned int rlimit = 0;
+    bool convert = false;
     char *realArgs[argc];
     int numArgs = 0;
 
     int option;
+    struct option longOptions[] = {
+        {"timeout", required_argument, NULL, OPTION_TIMEOUT},
+        {"rlimit", required_argument, NULL, OPTION_RLIMIT},
+        {"convert", no_argument, NULL, OPTION_CONVERT},
+        {NULL, 0, NULL, 0}};
 
-    while ((option = getopt(argc, argv, ":hvFBMGR:tfo:")) != -1)
+    while ((option = getopt_long(argc, argv, ":hvFBbMGR:tfo:j:A:D:S:sz", longOptions, NULL)) != -1)
     {
         switch (option)
         {
+        case OPTION_TIMEOUT:
+            if (!parseUnsignedOption(optarg, &timeout))
+            {
+                printf("Invalid timeout: %s\n", optarg);
+                return EXIT_FAILURE;
+            }
+            break;
+        case OPTION_RLIMIT:
+            if (!parseUnsignedOption(optarg, &rlimit))
+            {
+                printf("Invalid resource limit: %s\n", optarg);
+                return EXIT_FAILURE;
+            }
+            break;
+        case OPTION_CONVERT:
+            convert = true;
+            break;
         case 'h':
             usage();
             return EXIT_SUCCESS;
@@ -102,9 +408,56 @@ int main(int argc, char *argv[])
         case 'B':
             bruteForce = true;
             break;
+        case 'b':
+            branchAndBound = true;
+            break;
+        case 'j':
+        {
+            unsigned int threads;
+            if (!parseUnsignedOption(optarg, &threads) || threads < 1 || threads > MAX_BRUTE_FORCE_THREADS)
+            {
+                printf("Invalid number of threads (from 1 to %d): %s\n", MAX_BRUTE_FORCE_THREADS, optarg);
+                return EXIT_FAILURE;
+            }
+            numThreads = threads;
+            break;
+        }
         case 'R':
             reduction = true;
-            size = atoi(optarg);
+            autoCost = 0 == strcmp(optarg, "auto");
+            if (!autoCost)
+            {
+                unsigned int cost;
+                if (!parseUnsignedOption(optarg, &cost) || cost > INT_MAX)
+                {
+                    printf("Invalid cost: %s\n", optarg);
+                    return EXIT_FAILURE;
+                }
+                size = cost;
+            }
+            break;
+        case 'A':
+        {
+            AtMostOneEncoding encoding;
+            if (!getAtMostOneEncodingFromName(optarg, &encoding))
+            {
+                printf("Unknown encoding: %s\n", optarg);
+                return EXIT_FAILURE;
+            }
+            setAtMostOneEncoding(encoding);
+            break;
+        }
+        case 's':
+            setSymmetryBreaking(true);
+            break;
+        case 'z':
+            compress = true;
+            break;
+        case 'D':
+            dimacsName = optarg;
+            break;
+        case 'S':
+            externalSolver = optarg;
             break;
         case 'F':
             //printf("Don't insist, I'm not showing you the solution of the assignment yet!\n");
@@ -123,7 +476,7 @@ int main(int argc, char *argv[])
             solutionName = optarg;
             break;
         case '?':
-            printf("unknown option: %c\n", optopt);
+            printf("unknown option: %s\n", argv[optind - 1]);
             break;
         }
     }
@@ -134,7 +487,20 @@ int main(int argc, char *argv[])
         return 0;
     }
 
-    Graph graph = getGraphFromFile(argv[optind]);
+    if (convert)
+    {
+        if (argc - optind < 2)
+        {
+            printf("--convert needs an input and an output file. Exiting.\n");
+            return EXIT_FAILURE;
+        }
+        Graph graph = loadGraph(argv[optind]);
+        bool saved = saveGraphBinary(graph, argv[optind + 1]);
+        deleteGraph(graph);
+        return saved ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    Graph graph = loadGraph(argv[optind]);
 
     if (verbose)
         printGraph(graph);
@@ -158,9 +524,9 @@ int main(int argc, char *argv[])
     if (bruteForce)
     {
         printf("\n*******************\n*** Brute Force ***\n*******************\n\n");
-        clock_t start = clock();
-        int res = BruteForceEdgeCon(biGraph);
-        double end = (double)(clock() - start) / CLOCKS_PER_SEC;
+        double start = getWallClockTime();
+        int res = ParallelBruteForceEdgeCon(biGraph, numThreads);
+        double end = getWallClockTime() - start;
         if (res >= 0)
         {
             printf("Brute force computed the solution in %g seconds: All possible assignations of translators allow nodes to communicate with at most %d translators on the path\n", end, res);
@@ -182,26 +548,100 @@ int main(int argc, char *argv[])
         resetTranslator(biGraph);
     }
 
-    if (reduction)
+    if (branchAndBound)
     {
-        printf("\n************************\n*** Reduction to SAT ***\n************************\n\n");
-
-        if (size <= 0)
+        printf("\n************************\n*** Branch and Bound ***\n************************\n\n");
+        SearchStatistics statistics;
+        double start = getWallClockTime();
+        int res = BranchAndBoundEdgeCon(biGraph, &statistics);
+        double end = getWallClockTime() - start;
+        printf("%lld nodes explored, %lld pruned\n", statistics.numExploredNodes, statistics.numPrunedNodes);
+        if (res >= 0)
         {
-            printf("No weight given, or weight given less than 0, I refuse to compute the formula for it!\n");
+            printf("Branch and bound computed the solution in %g seconds: All possible assignations of translators allow nodes to communicate with at most %d translators on the path\n", end, res);
+            if (displayTerminal || outputFile)
+                printf("A translator set reaching that bound has been computed\n");
+            if (displayTerminal)
+                printTranslator(biGraph);
+            int length = strlen(solutionName) + 12;
+            char nameFile[length];
+            snprintf(nameFile, length, "%s_BB", solutionName);
+            if (outputFile)
+            {
+                createDotOfEdgeConGraph(biGraph, nameFile);
+                printf("Solution printed in sol/%s.dot.\n", nameFile);
+            }
         }
         else
+            printf("No solution found by Branch and Bound in %g seconds\n", end);
+        resetTranslator(biGraph);
+    }
+
+    if (reduction)
+    {
+        printf("\n************************\n*** Reduction to SAT ***\n************************\n\n");
+
+        if (autoCost)
         {
             Z3_context ctx = makeContext();
+            Z3Session session = createLimitedSession(ctx, timeout, rlimit);
+            Z3_model model;
+
+            double start = getWallClockTime();
+            int cost = EdgeConMaximalCost(session, biGraph, &model);
+            double end = getWallClockTime() - start;
+
+            if (cost < 0)
+            {
+                printf("Not able to decide the maximal cost in %g seconds.\n", end);
+                reportUndecided(session);
+            }
+            else
+            {
+                printf("cost computed in %g seconds\n", end);
+                if (0 == cost && getNumComponents(biGraph) > 1)
+                    printf("There is no translator set allowing all nodes to communicate.\n");
+                else if (NULL != model)
+                    printf("All possible translator sets allow all nodes to communicate with cost at most %d, and this bound is tight.\n", cost);
+                else
+                    printf("All possible translator sets allow all nodes to communicate with cost at most %d.\n", cost);
+            }
 
-            clock_t start = clock();
+            if (NULL != model)
+            {
+                int numComponent = getNumComponents(biGraph);
+                if (displayTerminal || outputFile || displayModel)
+                {
+                    printf("A translator set reaching that bound has been computed\n");
+                    getTranslatorSetFromModel(ctx, model, biGraph);
+                }
 
-            Z3_ast formula;
-            formula = EdgeConReduction(ctx, biGraph, size);
+                if (displayModel)
+                    printModel(ctx, model, biGraph, numComponent);
 
-            clock_t timeFormula = clock();
+                if (displayTerminal)
+                    printTranslator(biGraph);
 
-            printf("formula computed in %g seconds\n", (double)(timeFormula - start) / CLOCKS_PER_SEC);
+                if (outputFile)
+                {
+                    int length = strlen(solutionName) + 12;
+                    char nameFile[length];
+                    snprintf(nameFile, length, "%s_Sat", solutionName);
+                    createDotOfEdgeConGraph(biGraph, nameFile);
+                    printf("Solution printed in sol/%s.dot.\n", nameFile);
+                }
+                Z3_model_dec_ref(ctx, model);
+            }
+
+            deleteZ3Session(session);
+            Z3_del_context(ctx);
+        }
+        else
+        {
+            Z3_context ctx = makeContext();
+            Z3Session session = createLimitedSession(ctx, timeout, rlimit);
+            Z3_model model = NULL;
+            Z3_lbool isSat;
 
             if (printformula)
             {
@@ -209,24 +649,67 @@ int main(int argc, char *argv[])
                 struct stat st = {0};
                 if (stat("./sol", &st) == -1)
                     mkdir("./sol", 0777);
-                int length = strlen(solutionName) + 13;
+                int length = strlen(solutionName) + 16;
                 char nameFile[length];
-                snprintf(nameFile, length, "sol/%s.formula", solutionName);
-                FILE *file = fopen(nameFile, "w");
-                fprintf(file, "%s\n", Z3_ast_to_string(ctx, formula));
-                fclose(file);
-                printf("Formula printed in sol/%s.formula\n", solutionName);
+                snprintf(nameFile, length, "sol/%s.formula%s", solutionName, compress ? ".gz" : "");
+                pid_t gzip;
+                FILE *file = openFormulaFile(nameFile, compress, &gzip);
+                if (NULL != file)
+                {
+                    EdgeConReductionToSmtLib(file, biGraph, size);
+                    if (closeFormulaFile(file, gzip))
+                        printf("Formula printed in %s\n", nameFile);
+                    else
+                        printf("Could not print the formula in %s\n", nameFile);
+                }
 #else
                 printf("Nah, I'm not displaying the formula in the given executable\n");
 #endif
             }
 
-            Z3_model model;
-            Z3_lbool isSat = solveFormula(ctx, formula, &model);
+            if (NULL != dimacsName)
+            {
+                int length = strlen(dimacsName) + 4;
+                char nameFile[length];
+                snprintf(nameFile, length, "%s%s", dimacsName, compress ? ".gz" : "");
+                pid_t gzip;
+                FILE *file = openFormulaFile(nameFile, compress, &gzip);
+                if (NULL != file)
+                {
+                    int numVariables = EdgeConReductionToDimacs(file, biGraph, size);
+                    if (closeFormulaFile(file, gzip) && numVariables >= 0)
+                        printf("DIMACS formula printed in %s\n", nameFile);
+                    else
+                        printf("Could not print the DIMACS formula in %s\n", nameFile);
+                }
+            }
+
+            if (NULL != externalSolver)
+            {
+                double start = getWallClockTime();
+                isSat = solveWithExternalSolver(externalSolver, biGraph, size, displayTerminal || outputFile);
+                printf("solution computed by %s in %g seconds\n", externalSolver, getWallClockTime() - start);
+                if (displayModel)
+                    printf("The tree over the components is only displayed with Z3.\n");
+                displayModel = false;
+            }
+            else
+            {
+                double start = getWallClockTime();
 
-            clock_t timeSat = clock();
+                Z3_ast formula;
+                formula = EdgeConReduction(ctx, biGraph, size);
 
-            printf("solution computed in %g seconds\n", (double)(timeSat - timeFormula) / CLOCKS_PER_SEC);
+                double timeFormula = getWallClockTime();
+
+                printf("formula computed in %g seconds\n", timeFormula - start);
+
+                assertInZ3Session(session, formula);
+                isSat = checkZ3Session(session);
+                model = getZ3SessionModel(session);
+
+                printf("solution computed in %g seconds\n", getWallClockTime() - timeFormula);
+            }
 
             switch (isSat)
             {
@@ -236,13 +719,15 @@ int main(int argc, char *argv[])
 
             case Z3_L_UNDEF:
                 printf("Not able to decide if there is a translator set forcing some nodes to communicate with cost bigger than %d.\n", size);
+                if (NULL == externalSolver)
+                    reportUndecided(session);
                 break;
 
             case Z3_L_TRUE:
                 printf("There is a translator set forcing some node to communicate with cost bigger than %d.\n", size);
 
                 int numComponent = getNumComponents(biGraph);
-                if (displayTerminal || outputFile || displayModel)
+                if (NULL == externalSolver && (displayTerminal || outputFile || displayModel))
                     getTranslatorSetFromModel(ctx, model, biGraph);
 
                 if (displayModel)
@@ -265,6 +750,7 @@ int main(int argc, char *argv[])
                 break;
             }
 
+            deleteZ3Session(session);
             Z3_del_context(ctx);
         }
     }
@@ -493,14 +493,24 @@ static const flex_int16_t yy_chk[120] =
 #include "GraphList.h"
 #include "Parser.h"
 
- 
- #define MAXSIZE  1024
-char any_name_s[MAXSIZE];
+/**
+ * @brief Counts the lines of a token.
+ * 
+ * @param state the state of the parsing.
+ * @param text the text of the token.
+ * @param length the length of @p text.
+ */
+static void countLines(parserState *state, const char *text, int length)
+{
+    for (int i = 0; i < length; i++)
+        if (text[i] == '\n') state->line++;
+}
 
-#line 501 "src/parser/Lexer.c"
+#line 510 "src/parser/Lexer.c"
 /* %option outfile="Lexer.c" header-file="Lexer.h"  //for normal make.*/
 #define YY_NO_UNISTD_H 1
-#line 504 "src/parser/Lexer.c"
+#define YY_EXTRA_TYPE parserState *
+#line 514 "src/parser/Lexer.c"
 
 #define INITIAL 0
 
@@ -774,9 +784,9 @@ YY_DECL
 		}
 
 	{
-#line 62 "src/parser/Lexer.l"
+#line 72 "src/parser/Lexer.l"
 
-#line 780 "src/parser/Lexer.c"
+#line 790 "src/parser/Lexer.c"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -831,132 +841,132 @@ do_action:	/* This label is used only to access EOF actions. */
 
 case 1:
 YY_RULE_SETUP
-#line 63 "src/parser/Lexer.l"
+#line 73 "src/parser/Lexer.l"
 { }
 	YY_BREAK
 case 2:
 /* rule 2 can match eol */
 YY_RULE_SETUP
-#line 64 "src/parser/Lexer.l"
-{ strcpy(any_name_s,yytext);
-                  yylval->name = any_name_s;
+#line 74 "src/parser/Lexer.l"
+{ countLines(yyextra, yytext, yyleng);
+                  yylval->text.start = yytext;
+                  yylval->text.length = yyleng;
                   return(T_STRING); }
 	YY_BREAK
 case 3:
 /* rule 3 can match eol */
 YY_RULE_SETUP
-#line 67 "src/parser/Lexer.l"
-;
+#line 78 "src/parser/Lexer.l"
+{ countLines(yyextra, yytext, yyleng); }
 	YY_BREAK
 case 4:
 YY_RULE_SETUP
-#line 68 "src/parser/Lexer.l"
+#line 79 "src/parser/Lexer.l"
 { return(T_LBRACKET); }
 	YY_BREAK
 case 5:
 YY_RULE_SETUP
-#line 69 "src/parser/Lexer.l"
+#line 80 "src/parser/Lexer.l"
 { return(T_RBRACKET); }
 	YY_BREAK
 case 6:
 YY_RULE_SETUP
-#line 70 "src/parser/Lexer.l"
+#line 81 "src/parser/Lexer.l"
 { return(T_LPAREN); }
 	YY_BREAK
 case 7:
 YY_RULE_SETUP
-#line 71 "src/parser/Lexer.l"
+#line 82 "src/parser/Lexer.l"
 { return(T_RPAREN); }
 	YY_BREAK
 case 8:
 YY_RULE_SETUP
-#line 72 "src/parser/Lexer.l"
+#line 83 "src/parser/Lexer.l"
 { return(T_LBRACE); }
 	YY_BREAK
 case 9:
 YY_RULE_SETUP
-#line 73 "src/parser/Lexer.l"
+#line 84 "src/parser/Lexer.l"
 { return(T_RBRACE); }
 	YY_BREAK
 case 10:
 YY_RULE_SETUP
-#line 74 "src/parser/Lexer.l"
+#line 85 "src/parser/Lexer.l"
 { return(T_COMMA); }
 	YY_BREAK
 case 11:
 YY_RULE_SETUP
-#line 75 "src/parser/Lexer.l"
+#line 86 "src/parser/Lexer.l"
 { return(T_COLON); }
 	YY_BREAK
 case 12:
 YY_RULE_SETUP
-#line 76 "src/parser/Lexer.l"
+#line 87 "src/parser/Lexer.l"
 { return(T_SEMI); }
 	YY_BREAK
 case 13:
 YY_RULE_SETUP
-#line 77 "src/parser/Lexer.l"
+#line 88 "src/parser/Lexer.l"
 { return(T_DEDGE); }
 	YY_BREAK
 case 14:
 YY_RULE_SETUP
-#line 78 "src/parser/Lexer.l"
+#line 89 "src/parser/Lexer.l"
 { return(T_UEDGE); }
 	YY_BREAK
 case 15:
 YY_RULE_SETUP
-#line 79 "src/parser/Lexer.l"
+#line 90 "src/parser/Lexer.l"
 { return(T_EQ); }
 	YY_BREAK
 case 16:
 YY_RULE_SETUP
-#line 80 "src/parser/Lexer.l"
+#line 91 "src/parser/Lexer.l"
 { return(T_DIGRAPH); }
 	YY_BREAK
 case 17:
 YY_RULE_SETUP
-#line 81 "src/parser/Lexer.l"
+#line 92 "src/parser/Lexer.l"
 { return(T_GRAPH); }
 	YY_BREAK
 case 18:
 YY_RULE_SETUP
-#line 82 "src/parser/Lexer.l"
+#line 93 "src/parser/Lexer.l"
 { return(T_SUBGRAPH); }
 	YY_BREAK
 case 19:
 YY_RULE_SETUP
-#line 83 "src/parser/Lexer.l"
+#line 94 "src/parser/Lexer.l"
 { return(T_AT); }
 	YY_BREAK
 case 20:
 YY_RULE_SETUP
-#line 84 "src/parser/Lexer.l"
+#line 95 "src/parser/Lexer.l"
 { return(T_STRICT); }
 	YY_BREAK
 case 21:
 YY_RULE_SETUP
-#line 85 "src/parser/Lexer.l"
+#line 96 "src/parser/Lexer.l"
 { return(T_NODE); }
 	YY_BREAK
 case 22:
 YY_RULE_SETUP
-#line 86 "src/parser/Lexer.l"
+#line 97 "src/parser/Lexer.l"
 { return(T_EDGE); }
 	YY_BREAK
 case 23:
 YY_RULE_SETUP
-#line 87 "src/parser/Lexer.l"
-{ //any_name_s = malloc(sizeof(yytext)+1);
-                  strcpy(any_name_s, yytext);
-                  yylval->name = any_name_s;
+#line 98 "src/parser/Lexer.l"
+{ yylval->text.start = yytext;
+                  yylval->text.length = yyleng;
                   return(T_ID); }
 	YY_BREAK
 case 24:
 YY_RULE_SETUP
-#line 92 "src/parser/Lexer.l"
+#line 102 "src/parser/Lexer.l"
 ECHO;
 	YY_BREAK
-#line 960 "src/parser/Lexer.c"
+#line 970 "src/parser/Lexer.c"
 case YY_STATE_EOF(INITIAL):
 	yyterminate();
 
@@ -2138,7 +2148,7 @@ void yyfree (void * ptr , yyscan_t yyscanner)
 
 #define YYTABLES_NAME "yytables"
 
-#line 92 "src/parser/Lexer.l"
+#line 102 "src/parser/Lexer.l"
 
 
 
@@ -246,9 +246,7 @@ void yyfree ( void * , yyscan_t yyscanner );
 #include <unistd.h>
 #endif
 
-#ifndef YY_EXTRA_TYPE
-#define YY_EXTRA_TYPE void *
-#endif
+#define YY_EXTRA_TYPE parserState *
 
 int yylex_init (yyscan_t* scanner);
 
@@ -502,7 +500,7 @@ extern int yylex \
 #undef yyTABLES_NAME
 #endif
 
-#line 92 "src/parser/Lexer.l"
+#line 102 "src/parser/Lexer.l"
 
 
 #line 509 "src/parser/Lexer.h"
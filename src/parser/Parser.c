@@ -1,8 +1,8 @@
-/* A Bison parser, made by GNU Bison 3.5.1.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2020 Free Software Foundation,
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
    Inc.
 
    This program is free software: you can redistribute it and/or modify
@@ -16,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -34,6 +34,10 @@
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -41,14 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Undocumented macros, especially those whose name start with YY_,
-   are private implementation details.  Do not rely on them.  */
-
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "3.5.1"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -82,6 +83,7 @@
  * 
  */
  
+#include <string.h>
 #include "GraphList.h"
 #include "Parser.h"
 #include "Lexer.h"
@@ -89,12 +91,24 @@
 
 int yyerror(GraphList *expression, yyscan_t scanner, const char *msg) {
     /* Add error handling routine as needed */
-    printf("Erreur: %s\n",msg);
+    parserState *state = yyget_extra(scanner);
+    printf("Erreur: %s:%d: %s\n",state->fileName,state->line,msg);
     return 0;
 }
+
+/**
+ * @brief Tells if a token is a given keyword.
+ *
+ * @param token the token.
+ * @param keyword the keyword.
+ * @return true if the text of @p token is @p keyword.
+ */
+static bool isKeyword(textSlice token, const char *keyword) {
+    return strlen(keyword) == (size_t)token.length && strncmp(token.start, keyword, token.length) == 0;
+}
  
 
-#line 98 "src/parser/Parser.c"
+#line 112 "src/parser/Parser.c"
 
 # ifndef YY_CAST
 #  ifdef __cplusplus
@@ -117,88 +131,60 @@ int yyerror(GraphList *expression, yyscan_t scanner, const char *msg) {
 #  endif
 # endif
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
-
-/* Use api.header.include to #include this header
-   instead of duplicating it here.  */
-#ifndef YY_YY_SRC_PARSER_PARSER_H_INCLUDED
-# define YY_YY_SRC_PARSER_PARSER_H_INCLUDED
-/* Debug traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 0
-#endif
-#if YYDEBUG
-extern int yydebug;
-#endif
-/* "%code requires" blocks.  */
-#line 29 "src/parser/Parser.y"
-
-  typedef void* yyscan_t;
-  enum stateType {None,Init,Final,InitFinal};
-  typedef struct {
-      enum stateType automataInfo;
-      char* color;
-  } stateInformation;
-
-#line 150 "src/parser/Parser.c"
-
-/* Token type.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-  enum yytokentype
-  {
-    T_LPAREN = 258,
-    T_RPAREN = 259,
-    T_COMMA = 260,
-    T_COLON = 261,
-    T_SEMI = 262,
-    T_AT = 263,
-    T_LBRACKET = 264,
-    T_RBRACKET = 265,
-    T_LBRACE = 266,
-    T_RBRACE = 267,
-    T_STRING = 268,
-    T_EQ = 269,
-    T_DIGRAPH = 270,
-    T_EDGE = 271,
-    T_DEDGE = 272,
-    T_UEDGE = 273,
-    T_GRAPH = 274,
-    T_ID = 275,
-    T_NODE = 276,
-    T_STRICT = 277,
-    T_SUBGRAPH = 278
-  };
-#endif
-
-/* Value type.  */
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-union YYSTYPE
+#include "Parser.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
 {
-#line 49 "src/parser/Parser.y"
-
-    char* name;
-    stateInformation stateInfo;
-
-#line 190 "src/parser/Parser.c"
-
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_T_LPAREN = 3,                   /* T_LPAREN  */
+  YYSYMBOL_T_RPAREN = 4,                   /* T_RPAREN  */
+  YYSYMBOL_T_COMMA = 5,                    /* T_COMMA  */
+  YYSYMBOL_T_COLON = 6,                    /* T_COLON  */
+  YYSYMBOL_T_SEMI = 7,                     /* T_SEMI  */
+  YYSYMBOL_T_AT = 8,                       /* T_AT  */
+  YYSYMBOL_T_LBRACKET = 9,                 /* T_LBRACKET  */
+  YYSYMBOL_T_RBRACKET = 10,                /* T_RBRACKET  */
+  YYSYMBOL_T_LBRACE = 11,                  /* T_LBRACE  */
+  YYSYMBOL_T_RBRACE = 12,                  /* T_RBRACE  */
+  YYSYMBOL_T_STRING = 13,                  /* T_STRING  */
+  YYSYMBOL_T_EQ = 14,                      /* T_EQ  */
+  YYSYMBOL_T_DIGRAPH = 15,                 /* T_DIGRAPH  */
+  YYSYMBOL_T_EDGE = 16,                    /* T_EDGE  */
+  YYSYMBOL_T_DEDGE = 17,                   /* T_DEDGE  */
+  YYSYMBOL_T_UEDGE = 18,                   /* T_UEDGE  */
+  YYSYMBOL_T_GRAPH = 19,                   /* T_GRAPH  */
+  YYSYMBOL_T_ID = 20,                      /* T_ID  */
+  YYSYMBOL_T_NODE = 21,                    /* T_NODE  */
+  YYSYMBOL_T_STRICT = 22,                  /* T_STRICT  */
+  YYSYMBOL_T_SUBGRAPH = 23,                /* T_SUBGRAPH  */
+  YYSYMBOL_YYACCEPT = 24,                  /* $accept  */
+  YYSYMBOL_input = 25,                     /* input  */
+  YYSYMBOL_strict = 26,                    /* strict  */
+  YYSYMBOL_graph_type = 27,                /* graph_type  */
+  YYSYMBOL_stmt_list = 28,                 /* stmt_list  */
+  YYSYMBOL_stmt_list1 = 29,                /* stmt_list1  */
+  YYSYMBOL_stmt = 30,                      /* stmt  */
+  YYSYMBOL_stmt1 = 31,                     /* stmt1  */
+  YYSYMBOL_attr_stmt = 32,                 /* attr_stmt  */
+  YYSYMBOL_attr_list = 33,                 /* attr_list  */
+  YYSYMBOL_a_list = 34,                    /* a_list  */
+  YYSYMBOL_attr_assignment = 35,           /* attr_assignment  */
+  YYSYMBOL_idrhs = 36,                     /* idrhs  */
+  YYSYMBOL_node_stmt = 37,                 /* node_stmt  */
+  YYSYMBOL_node_id = 38,                   /* node_id  */
+  YYSYMBOL_port = 39,                      /* port  */
+  YYSYMBOL_port_location = 40,             /* port_location  */
+  YYSYMBOL_port_angle = 41,                /* port_angle  */
+  YYSYMBOL_edge_stmt = 42,                 /* edge_stmt  */
+  YYSYMBOL_edgerhs = 43,                   /* edgerhs  */
+  YYSYMBOL_subgraph = 44,                  /* subgraph  */
+  YYSYMBOL_edgeop = 45                     /* edgeop  */
 };
-typedef union YYSTYPE YYSTYPE;
-# define YYSTYPE_IS_TRIVIAL 1
-# define YYSTYPE_IS_DECLARED 1
-#endif
-
-
-
-int yyparse (GraphList *graph, yyscan_t scanner);
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-#endif /* !YY_YY_SRC_PARSER_PARSER_H_INCLUDED  */
 
 
 
@@ -239,6 +225,18 @@ typedef int_least16_t yytype_int16;
 typedef short yytype_int16;
 #endif
 
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
 #if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
 typedef __UINT_LEAST8_TYPE__ yytype_uint8;
 #elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
@@ -298,6 +296,7 @@ typedef int yytype_uint16;
 
 #define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
 
+
 /* Stored state numbers (used for stacks). */
 typedef yytype_int8 yy_state_t;
 
@@ -316,6 +315,7 @@ typedef int yy_state_fast_t;
 # endif
 #endif
 
+
 #ifndef YY_ATTRIBUTE_PURE
 # if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
 #  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
@@ -334,17 +334,23 @@ typedef int yy_state_fast_t;
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && ! defined __ICC && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                            \
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
     _Pragma ("GCC diagnostic push")                                     \
     _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
 # define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
@@ -373,7 +379,7 @@ typedef int yy_state_fast_t;
 
 #define YY_ASSERT(E) ((void) (0 && (E)))
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#if !defined yyoverflow
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -438,8 +444,7 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
@@ -515,14 +520,16 @@ union yyalloc
 /* YYNSTATES -- Number of states.  */
 #define YYNSTATES  81
 
-#define YYUNDEFTOK  2
+/* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   278
 
 
 /* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
    as returned by yylex, with out-of-bounds checking.  */
-#define YYTRANSLATE(YYX)                                                \
-  (0 <= (YYX) && (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
 
 /* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
    as returned by yylex.  */
@@ -559,44 +566,47 @@ static const yytype_int8 yytranslate[] =
 };
 
 #if YYDEBUG
-  /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_uint8 yyrline[] =
 {
-       0,    93,    93,    96,    97,   100,   101,   104,   105,   108,
-     109,   111,   112,   115,   116,   117,   118,   119,   122,   123,
-     124,   127,   128,   129,   143,   146,   147,   161,   177,   181,
-     183,   187,   188,   200,   204,   210,   211,   212,   213,   216,
-     217,   220,   223,   227,   231,   232,   235,   238,   245,   246,
-     247,   250,   251
+       0,   117,   117,   120,   121,   124,   125,   128,   129,   132,
+     133,   135,   136,   139,   140,   141,   142,   143,   146,   147,
+     148,   151,   152,   153,   164,   167,   168,   179,   192,   196,
+     197,   200,   201,   211,   212,   215,   216,   217,   218,   221,
+     222,   225,   228,   231,   234,   235,   238,   241,   247,   248,
+     249,   252,   253
 };
 #endif
 
-#if YYDEBUG || YYERROR_VERBOSE || 0
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "T_LPAREN", "T_RPAREN", "T_COMMA",
-  "T_COLON", "T_SEMI", "T_AT", "T_LBRACKET", "T_RBRACKET", "T_LBRACE",
-  "T_RBRACE", "T_STRING", "T_EQ", "T_DIGRAPH", "T_EDGE", "T_DEDGE",
-  "T_UEDGE", "T_GRAPH", "T_ID", "T_NODE", "T_STRICT", "T_SUBGRAPH",
-  "$accept", "input", "strict", "graph_type", "stmt_list", "stmt_list1",
-  "stmt", "stmt1", "attr_stmt", "attr_list", "a_list", "attr_assignment",
-  "idrhs", "node_stmt", "node_id", "port", "port_location", "port_angle",
-  "edge_stmt", "edgerhs", "subgraph", "edgeop", YY_NULLPTR
+  "\"end of file\"", "error", "\"invalid token\"", "T_LPAREN", "T_RPAREN",
+  "T_COMMA", "T_COLON", "T_SEMI", "T_AT", "T_LBRACKET", "T_RBRACKET",
+  "T_LBRACE", "T_RBRACE", "T_STRING", "T_EQ", "T_DIGRAPH", "T_EDGE",
+  "T_DEDGE", "T_UEDGE", "T_GRAPH", "T_ID", "T_NODE", "T_STRICT",
+  "T_SUBGRAPH", "$accept", "input", "strict", "graph_type", "stmt_list",
+  "stmt_list1", "stmt", "stmt1", "attr_stmt", "attr_list", "a_list",
+  "attr_assignment", "idrhs", "node_stmt", "node_id", "port",
+  "port_location", "port_angle", "edge_stmt", "edgerhs", "subgraph",
+  "edgeop", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[NUM] -- (External) token number corresponding to the
-   (internal) symbol number NUM (which must be that of a token).  */
-static const yytype_int16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
 #define YYPACT_NINF (-48)
 
@@ -608,8 +618,8 @@ static const yytype_int16 yytoknum[] =
 #define yytable_value_is_error(Yyn) \
   0
 
-  /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-     STATE-NUM.  */
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
 static const yytype_int8 yypact[] =
 {
       11,   -48,     9,     8,   -48,   -48,   -48,     6,    19,    -5,
@@ -623,9 +633,9 @@ static const yytype_int8 yypact[] =
      -48
 };
 
-  /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-     Performed when YYTABLE does not specify something else to do.  Zero
-     means the default is an error.  */
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
 static const yytype_int8 yydefact[] =
 {
        3,     4,     0,     0,     1,     5,     6,     0,     0,     8,
@@ -639,7 +649,7 @@ static const yytype_int8 yydefact[] =
       40
 };
 
-  /* YYPGOTO[NTERM-NUM].  */
+/* YYPGOTO[NTERM-NUM].  */
 static const yytype_int8 yypgoto[] =
 {
      -48,   -48,   -48,   -48,    -9,   -48,    53,   -48,   -48,   -13,
@@ -647,17 +657,17 @@ static const yytype_int8 yypgoto[] =
      -48,   -48
 };
 
-  /* YYDEFGOTO[NTERM-NUM].  */
+/* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int8 yydefgoto[] =
 {
-      -1,     2,     3,     7,    17,    18,    19,    20,    21,    30,
+       0,     2,     3,     7,    17,    18,    19,    20,    21,    30,
       53,    22,    23,    24,    25,    34,    35,    36,    26,    47,
       27,    48
 };
 
-  /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-     positive, shift that token.  If negative, reduce the rule whose
-     number is the opposite.  If YYTABLE_NINF, syntax error.  */
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int8 yytable[] =
 {
       31,    28,    37,    54,    49,    68,    10,    69,    11,     4,
@@ -684,8 +694,8 @@ static const yytype_int8 yycheck[] =
       36,    35
 };
 
-  /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-     symbol of state STATE-NUM.  */
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
 static const yytype_int8 yystos[] =
 {
        0,    22,    25,    26,     0,    15,    19,    27,    20,    11,
@@ -699,7 +709,7 @@ static const yytype_int8 yystos[] =
        4
 };
 
-  /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
 static const yytype_int8 yyr1[] =
 {
        0,    24,    25,    26,    26,    27,    27,    28,    28,    29,
@@ -710,7 +720,7 @@ static const yytype_int8 yyr1[] =
       44,    45,    45
 };
 
-  /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
 static const yytype_int8 yyr2[] =
 {
        0,     2,     6,     0,     1,     1,     1,     1,     0,     1,
@@ -722,14 +732,15 @@ static const yytype_int8 yyr2[] =
 };
 
 
+enum { YYENOMEM = -2 };
+
 #define yyerrok         (yyerrstatus = 0)
 #define yyclearin       (yychar = YYEMPTY)
-#define YYEMPTY         (-2)
-#define YYEOF           0
 
 #define YYACCEPT        goto yyacceptlab
 #define YYABORT         goto yyabortlab
 #define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
 
 #define YYRECOVERING()  (!!yyerrstatus)
@@ -751,10 +762,9 @@ static const yytype_int8 yyr2[] =
       }                                                           \
   while (0)
 
-/* Error token number */
-#define YYTERROR        1
-#define YYERRCODE       256
-
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
 
 /* Enable debugging if requested.  */
@@ -771,19 +781,16 @@ do {                                            \
     YYFPRINTF Args;                             \
 } while (0)
 
-/* This macro is provided for backward compatibility. */
-#ifndef YY_LOCATION_PRINT
-# define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-#endif
 
 
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)                    \
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
 do {                                                                      \
   if (yydebug)                                                            \
     {                                                                     \
       YYFPRINTF (stderr, "%s ", Title);                                   \
       yy_symbol_print (stderr,                                            \
-                  Type, Value, graph, scanner); \
+                  Kind, Value, graph, scanner); \
       YYFPRINTF (stderr, "\n");                                           \
     }                                                                     \
 } while (0)
@@ -794,20 +801,17 @@ do {                                                                      \
 `-----------------------------------*/
 
 static void
-yy_symbol_value_print (FILE *yyo, int yytype, YYSTYPE const * const yyvaluep, GraphList *graph, yyscan_t scanner)
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, GraphList *graph, yyscan_t scanner)
 {
   FILE *yyoutput = yyo;
-  YYUSE (yyoutput);
-  YYUSE (graph);
-  YYUSE (scanner);
+  YY_USE (yyoutput);
+  YY_USE (graph);
+  YY_USE (scanner);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyo, yytoknum[yytype], *yyvaluep);
-# endif
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YYUSE (yytype);
+  YY_USE (yykind);
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
@@ -817,12 +821,13 @@ yy_symbol_value_print (FILE *yyo, int yytype, YYSTYPE const * const yyvaluep, Gr
 `---------------------------*/
 
 static void
-yy_symbol_print (FILE *yyo, int yytype, YYSTYPE const * const yyvaluep, GraphList *graph, yyscan_t scanner)
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, GraphList *graph, yyscan_t scanner)
 {
   YYFPRINTF (yyo, "%s %s (",
-             yytype < YYNTOKENS ? "token" : "nterm", yytname[yytype]);
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyo, yytype, yyvaluep, graph, scanner);
+  yy_symbol_value_print (yyo, yykind, yyvaluep, graph, scanner);
   YYFPRINTF (yyo, ")");
 }
 
@@ -855,7 +860,8 @@ do {                                                            \
 `------------------------------------------------*/
 
 static void
-yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, int yyrule, GraphList *graph, yyscan_t scanner)
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule, GraphList *graph, yyscan_t scanner)
 {
   int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
@@ -867,9 +873,8 @@ yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, int yyrule, GraphList *graph
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
       yy_symbol_print (stderr,
-                       yystos[+yyssp[yyi + 1 - yynrhs]],
-                       &yyvsp[(yyi + 1) - (yynrhs)]
-                                              , graph, scanner);
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)], graph, scanner);
       YYFPRINTF (stderr, "\n");
     }
 }
@@ -884,8 +889,8 @@ do {                                    \
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
@@ -908,260 +913,35 @@ int yydebug;
 #endif
 
 
-#if YYERROR_VERBOSE
-
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
-#  else
-/* Return the length of YYSTR.  */
-static YYPTRDIFF_T
-yystrlen (const char *yystr)
-{
-  YYPTRDIFF_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
-
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
-
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
-
-  return yyd - 1;
-}
-#  endif
-# endif
-
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYPTRDIFF_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYPTRDIFF_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-        switch (*++yyp)
-          {
-          case '\'':
-          case ',':
-            goto do_not_strip_quotes;
-
-          case '\\':
-            if (*++yyp != '\\')
-              goto do_not_strip_quotes;
-            else
-              goto append;
-
-          append:
-          default:
-            if (yyres)
-              yyres[yyn] = *yyp;
-            yyn++;
-            break;
-
-          case '"':
-            if (yyres)
-              yyres[yyn] = '\0';
-            return yyn;
-          }
-    do_not_strip_quotes: ;
-    }
-
-  if (yyres)
-    return yystpcpy (yyres, yystr) - yyres;
-  else
-    return yystrlen (yystr);
-}
-# endif
-
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
-
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
-static int
-yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
-                yy_state_t *yyssp, int yytoken)
-{
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = YY_NULLPTR;
-  /* Arguments of yyformat: reported tokens (one for the "unexpected",
-     one per "expected"). */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Actual size of YYARG. */
-  int yycount = 0;
-  /* Cumulated lengths of YYARG.  */
-  YYPTRDIFF_T yysize = 0;
-
-  /* There are many possibilities here to consider:
-     - If this state is a consistent state with a default action, then
-       the only way this function was invoked is if the default action
-       is an error action.  In that case, don't check for expected
-       tokens because there are none.
-     - The only way there can be no lookahead present (in yychar) is if
-       this state is a consistent state with a default action.  Thus,
-       detecting the absence of a lookahead is sufficient to determine
-       that there is no unexpected or expected token to report.  In that
-       case, just report a simple "syntax error".
-     - Don't assume there isn't a lookahead just because this state is a
-       consistent state with a default action.  There might have been a
-       previous inconsistent state, consistent state with a non-default
-       action, or user semantic action that manipulated yychar.
-     - Of course, the expected token list depends on states to have
-       correct lookahead information, and it depends on the parser not
-       to perform extra reductions after fetching a lookahead from the
-       scanner and before detecting a syntax error.  Thus, state merging
-       (from LALR or IELR) and default reductions corrupt the expected
-       token list.  However, the list is correct for canonical LR with
-       one exception: it will still contain any token that will not be
-       accepted due to an error action in a later state.
-  */
-  if (yytoken != YYEMPTY)
-    {
-      int yyn = yypact[+*yyssp];
-      YYPTRDIFF_T yysize0 = yytnamerr (YY_NULLPTR, yytname[yytoken]);
-      yysize = yysize0;
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                {
-                  YYPTRDIFF_T yysize1
-                    = yysize + yytnamerr (YY_NULLPTR, yytname[yyx]);
-                  if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
-                    yysize = yysize1;
-                  else
-                    return 2;
-                }
-              }
-        }
-    }
-
-  switch (yycount)
-    {
-# define YYCASE_(N, S)                      \
-      case N:                               \
-        yyformat = S;                       \
-      break
-    default: /* Avoid compiler warnings. */
-      YYCASE_(0, YY_("syntax error"));
-      YYCASE_(1, YY_("syntax error, unexpected %s"));
-      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
-    }
 
-  {
-    /* Don't count the "%s"s in the final size, but reserve room for
-       the terminator.  */
-    YYPTRDIFF_T yysize1 = yysize + (yystrlen (yyformat) - 2 * yycount) + 1;
-    if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
-      yysize = yysize1;
-    else
-      return 2;
-  }
 
-  if (*yymsg_alloc < yysize)
-    {
-      *yymsg_alloc = 2 * yysize;
-      if (! (yysize <= *yymsg_alloc
-             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
-        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
-    }
 
-  /* Avoid sprintf, as that infringes on the user's name space.
-     Don't have undefined behavior even if the translation
-     produced a string with the wrong number of "%s"s.  */
-  {
-    char *yyp = *yymsg;
-    int yyi = 0;
-    while ((*yyp = *yyformat) != '\0')
-      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
-        {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
-          yyformat += 2;
-        }
-      else
-        {
-          ++yyp;
-          ++yyformat;
-        }
-  }
-  return 0;
-}
-#endif /* YYERROR_VERBOSE */
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, GraphList *graph, yyscan_t scanner)
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, GraphList *graph, yyscan_t scanner)
 {
-  YYUSE (yyvaluep);
-  YYUSE (graph);
-  YYUSE (scanner);
+  YY_USE (yyvaluep);
+  YY_USE (graph);
+  YY_USE (scanner);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YYUSE (yytype);
+  YY_USE (yykind);
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
 
 
+
+
 /*----------.
 | yyparse.  |
 `----------*/
@@ -1169,7 +949,7 @@ yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, GraphList *graph,
 int
 yyparse (GraphList *graph, yyscan_t scanner)
 {
-/* The lookahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
 
@@ -1180,45 +960,38 @@ YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
 YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
 
     /* Number of syntax errors so far.  */
-    int yynerrs;
+    int yynerrs = 0;
 
-    yy_state_fast_t yystate;
+    yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
+    int yyerrstatus = 0;
 
-    /* The stacks and their tools:
-       'yyss': related to states.
-       'yyvs': related to semantic values.
-
-       Refer to the stacks through separate pointers, to allow yyoverflow
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
-    /* The state stack.  */
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
     yy_state_t yyssa[YYINITDEPTH];
-    yy_state_t *yyss;
-    yy_state_t *yyssp;
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-    /* The semantic value stack.  */
+    /* The semantic value stack: array, bottom, top.  */
     YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
-
-    YYPTRDIFF_T yystacksize;
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken = 0;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYPTRDIFF_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
@@ -1226,16 +999,10 @@ YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yyssp = yyss = yyssa;
-  yyvsp = yyvs = yyvsa;
-  yystacksize = YYINITDEPTH;
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
   yychar = YYEMPTY; /* Cause a token to be read.  */
+
   goto yysetstate;
 
 
@@ -1257,10 +1024,11 @@ yysetstate:
   YY_IGNORE_USELESS_CAST_BEGIN
   *yyssp = YY_CAST (yy_state_t, yystate);
   YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
 #if !defined yyoverflow && !defined YYSTACK_RELOCATE
-    goto yyexhaustedlab;
+    YYNOMEM;
 #else
     {
       /* Get the current used size of the three stacks, in elements.  */
@@ -1288,7 +1056,7 @@ yysetstate:
 # else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-        goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
         yystacksize = YYMAXDEPTH;
@@ -1299,10 +1067,10 @@ yysetstate:
           YY_CAST (union yyalloc *,
                    YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
         if (! yyptr)
-          goto yyexhaustedlab;
+          YYNOMEM;
         YYSTACK_RELOCATE (yyss_alloc, yyss);
         YYSTACK_RELOCATE (yyvs_alloc, yyvs);
-# undef YYSTACK_RELOCATE
+#  undef YYSTACK_RELOCATE
         if (yyss1 != yyssa)
           YYSTACK_FREE (yyss1);
       }
@@ -1321,6 +1089,7 @@ yysetstate:
     }
 #endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
+
   if (yystate == YYFINAL)
     YYACCEPT;
 
@@ -1341,18 +1110,29 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
+      YYDPRINTF ((stderr, "Reading a token\n"));
       yychar = yylex (&yylval, scanner);
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -1421,32 +1201,32 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-  case 5:
-#line 100 "src/parser/Parser.y"
+  case 5: /* graph_type: T_DIGRAPH  */
+#line 124 "src/parser/Parser.y"
                         { graph->directed = true;}
-#line 1428 "src/parser/Parser.c"
+#line 1208 "src/parser/Parser.c"
     break;
 
-  case 6:
-#line 101 "src/parser/Parser.y"
+  case 6: /* graph_type: T_GRAPH  */
+#line 125 "src/parser/Parser.y"
                         { graph->directed = false;}
-#line 1434 "src/parser/Parser.c"
+#line 1214 "src/parser/Parser.c"
     break;
 
-  case 21:
-#line 127 "src/parser/Parser.y"
+  case 21: /* attr_list: T_LBRACKET a_list T_RBRACKET  */
+#line 151 "src/parser/Parser.y"
                                                 { (yyval.stateInfo) = (yyvsp[-1].stateInfo); }
-#line 1440 "src/parser/Parser.c"
+#line 1220 "src/parser/Parser.c"
     break;
 
-  case 22:
-#line 128 "src/parser/Parser.y"
-                                                { (yyval.stateInfo).automataInfo = None; (yyval.stateInfo).color=NULL; }
-#line 1446 "src/parser/Parser.c"
+  case 22: /* attr_list: T_LBRACKET T_RBRACKET  */
+#line 152 "src/parser/Parser.y"
+                                                { (yyval.stateInfo).automataInfo = None; (yyval.stateInfo).color.start=NULL; }
+#line 1226 "src/parser/Parser.c"
     break;
 
-  case 23:
-#line 129 "src/parser/Parser.y"
+  case 23: /* attr_list: T_LBRACKET a_list T_RBRACKET attr_list  */
+#line 153 "src/parser/Parser.y"
                                                 { if((yyvsp[-2].stateInfo).automataInfo == None) (yyval.stateInfo).automataInfo = (yyvsp[0].stateInfo).automataInfo;
                                                   else{
                                                      if((yyvsp[0].stateInfo).automataInfo== None) (yyval.stateInfo).automataInfo = (yyvsp[-2].stateInfo).automataInfo;
@@ -1455,29 +1235,26 @@ yyreduce:
                                                         else (yyval.stateInfo).automataInfo = (yyvsp[-2].stateInfo).automataInfo;
                                                         }
                                                     }
-                                                if((yyvsp[-2].stateInfo).color == NULL) (yyval.stateInfo).color = (yyvsp[0].stateInfo).color;
-                                                else {
-                                                    if((yyvsp[0].stateInfo).color != NULL) free((yyvsp[0].stateInfo).color);
-                                                    (yyval.stateInfo).color = (yyvsp[-2].stateInfo).color;
-                                                    }
+                                                if((yyvsp[-2].stateInfo).color.start == NULL) (yyval.stateInfo).color = (yyvsp[0].stateInfo).color;
+                                                else (yyval.stateInfo).color = (yyvsp[-2].stateInfo).color;
                                                 }
-#line 1465 "src/parser/Parser.c"
+#line 1242 "src/parser/Parser.c"
     break;
 
-  case 24:
-#line 143 "src/parser/Parser.y"
+  case 24: /* attr_list: T_LBRACKET T_RBRACKET attr_list  */
+#line 164 "src/parser/Parser.y"
                                                 { (yyval.stateInfo) = (yyvsp[0].stateInfo); }
-#line 1471 "src/parser/Parser.c"
+#line 1248 "src/parser/Parser.c"
     break;
 
-  case 25:
-#line 146 "src/parser/Parser.y"
+  case 25: /* a_list: attr_assignment  */
+#line 167 "src/parser/Parser.y"
                                         { (yyval.stateInfo) = (yyvsp[0].stateInfo);}
-#line 1477 "src/parser/Parser.c"
+#line 1254 "src/parser/Parser.c"
     break;
 
-  case 26:
-#line 147 "src/parser/Parser.y"
+  case 26: /* a_list: attr_assignment T_COMMA a_list  */
+#line 168 "src/parser/Parser.y"
                                         { if((yyvsp[-2].stateInfo).automataInfo == None) (yyval.stateInfo).automataInfo = (yyvsp[0].stateInfo).automataInfo;
                                           else{
                                               if((yyvsp[0].stateInfo).automataInfo == None) (yyval.stateInfo).automataInfo = (yyvsp[-2].stateInfo).automataInfo;
@@ -1486,17 +1263,14 @@ yyreduce:
                                                   else (yyval.stateInfo).automataInfo = (yyvsp[-2].stateInfo).automataInfo;
                                               }
                                           }
-                                            if((yyvsp[-2].stateInfo).color == NULL) (yyval.stateInfo).color = (yyvsp[0].stateInfo).color;
-                                            else {
-                                                if((yyvsp[0].stateInfo).color != NULL) free((yyvsp[0].stateInfo).color);
-                                                (yyval.stateInfo).color = (yyvsp[-2].stateInfo).color;
-                                                }
+                                            if((yyvsp[-2].stateInfo).color.start == NULL) (yyval.stateInfo).color = (yyvsp[0].stateInfo).color;
+                                            else (yyval.stateInfo).color = (yyvsp[-2].stateInfo).color;
                                           }
-#line 1496 "src/parser/Parser.c"
+#line 1270 "src/parser/Parser.c"
     break;
 
-  case 27:
-#line 161 "src/parser/Parser.y"
+  case 27: /* a_list: attr_assignment a_list  */
+#line 179 "src/parser/Parser.y"
                                         { if((yyvsp[-1].stateInfo).automataInfo == None) (yyval.stateInfo).automataInfo = (yyvsp[0].stateInfo).automataInfo;
                                           else{
                                               if((yyvsp[0].stateInfo).automataInfo == None) (yyval.stateInfo).automataInfo = (yyvsp[-1].stateInfo).automataInfo;
@@ -1505,107 +1279,91 @@ yyreduce:
                                                   else (yyval.stateInfo).automataInfo = (yyvsp[-1].stateInfo).automataInfo;
                                               }
                                           }
-                                            if((yyvsp[-1].stateInfo).color == NULL) (yyval.stateInfo).color = (yyvsp[0].stateInfo).color;
-                                            else {
-                                                if((yyvsp[0].stateInfo).color != NULL) free((yyvsp[0].stateInfo).color);
-                                                (yyval.stateInfo).color = (yyvsp[-1].stateInfo).color;
-                                                }
+                                            if((yyvsp[-1].stateInfo).color.start == NULL) (yyval.stateInfo).color = (yyvsp[0].stateInfo).color;
+                                            else (yyval.stateInfo).color = (yyvsp[-1].stateInfo).color;
                                           }
-#line 1515 "src/parser/Parser.c"
+#line 1286 "src/parser/Parser.c"
     break;
 
-  case 28:
-#line 177 "src/parser/Parser.y"
+  case 28: /* attr_assignment: idrhs T_EQ idrhs  */
+#line 192 "src/parser/Parser.y"
                                      { 
-     if(strcmp((yyvsp[-2].name),"color")==0) { (yyval.stateInfo).automataInfo = None; (yyval.stateInfo).color = (yyvsp[0].name); free((yyvsp[-2].name));} else { (yyval.stateInfo).color=NULL; if (strcmp((yyvsp[-2].name),"initial")==0) (yyval.stateInfo).automataInfo = Init; else if(strcmp((yyvsp[-2].name),"final")==0) (yyval.stateInfo).automataInfo = Final; else (yyval.stateInfo).automataInfo = None; free((yyvsp[-2].name)); free((yyvsp[0].name));}}
-#line 1522 "src/parser/Parser.c"
+     if(isKeyword((yyvsp[-2].text),"color")) { (yyval.stateInfo).automataInfo = None; (yyval.stateInfo).color = (yyvsp[0].text);} else { (yyval.stateInfo).color.start=NULL; if (isKeyword((yyvsp[-2].text),"initial")) (yyval.stateInfo).automataInfo = Init; else if(isKeyword((yyvsp[-2].text),"final")) (yyval.stateInfo).automataInfo = Final; else (yyval.stateInfo).automataInfo = None;}}
+#line 1293 "src/parser/Parser.c"
     break;
 
-  case 29:
-#line 181 "src/parser/Parser.y"
-                    { (yyval.name) = (char*)malloc((strlen((yyvsp[0].name))+1)*sizeof(char)); strcpy((yyval.name),(yyvsp[0].name));
-                    }
-#line 1529 "src/parser/Parser.c"
+  case 29: /* idrhs: T_ID  */
+#line 196 "src/parser/Parser.y"
+                    { (yyval.text) = (yyvsp[0].text); }
+#line 1299 "src/parser/Parser.c"
     break;
 
-  case 30:
-#line 183 "src/parser/Parser.y"
-                    { (yyval.name) = (char*)malloc((strlen((yyvsp[0].name))+1)*sizeof(char)); strcpy((yyval.name),(yyvsp[0].name));
-                    }
-#line 1536 "src/parser/Parser.c"
+  case 30: /* idrhs: T_STRING  */
+#line 197 "src/parser/Parser.y"
+                    { (yyval.text) = (yyvsp[0].text); }
+#line 1305 "src/parser/Parser.c"
     break;
 
-  case 32:
-#line 188 "src/parser/Parser.y"
+  case 32: /* node_stmt: node_id attr_list  */
+#line 201 "src/parser/Parser.y"
                             {   switch((yyvsp[0].stateInfo).automataInfo)
                                 {
-                                    case Init: if(graph->nodes == NULL) graph->nodes = addNode((yyvsp[-1].name),true,false,(yyvsp[0].stateInfo).color,NULL); else addOrUpdateNode((yyvsp[-1].name),true,false,(yyvsp[0].stateInfo).color,graph->nodes); break;
-                                    case Final: if(graph->nodes == NULL) graph->nodes = addNode((yyvsp[-1].name),false,true,(yyvsp[0].stateInfo).color,NULL); else addOrUpdateNode((yyvsp[-1].name),false,true,(yyvsp[0].stateInfo).color,graph->nodes); break;
-                                    case InitFinal: if(graph->nodes == NULL) graph->nodes = addNode((yyvsp[-1].name),true,true,(yyvsp[0].stateInfo).color,NULL); else addOrUpdateNode((yyvsp[-1].name),true,true,(yyvsp[0].stateInfo).color,graph->nodes); break;
-                                    case None: if(graph->nodes == NULL) graph->nodes = addNode((yyvsp[-1].name),false,false,(yyvsp[0].stateInfo).color,NULL); else addOrUpdateNode((yyvsp[-1].name),false,false,(yyvsp[0].stateInfo).color,graph->nodes); break;
+                                    case Init: updateNode(graph,(yyvsp[-1].node),true,false,(yyvsp[0].stateInfo).color.start,(yyvsp[0].stateInfo).color.length); break;
+                                    case Final: updateNode(graph,(yyvsp[-1].node),false,true,(yyvsp[0].stateInfo).color.start,(yyvsp[0].stateInfo).color.length); break;
+                                    case InitFinal: updateNode(graph,(yyvsp[-1].node),true,true,(yyvsp[0].stateInfo).color.start,(yyvsp[0].stateInfo).color.length); break;
+                                    case None: updateNode(graph,(yyvsp[-1].node),false,false,(yyvsp[0].stateInfo).color.start,(yyvsp[0].stateInfo).color.length); break;
                                 }
-                                free((yyvsp[-1].name));
-                                if((yyvsp[0].stateInfo).color!=NULL) free((yyvsp[0].stateInfo).color);
                             }
-#line 1551 "src/parser/Parser.c"
+#line 1318 "src/parser/Parser.c"
     break;
 
-  case 33:
-#line 200 "src/parser/Parser.y"
-                    { 
-                      (yyval.name) = (char*)malloc((strlen((yyvsp[0].name))+1)*sizeof(char)); strcpy((yyval.name),(yyvsp[0].name));
-                      if(graph->nodes == NULL) graph->nodes = addNode((yyvsp[0].name),false,false,NULL,NULL); else addOrUpdateNode((yyvsp[0].name),false,false,NULL,graph->nodes);
-                    }
-#line 1560 "src/parser/Parser.c"
+  case 33: /* node_id: T_ID  */
+#line 211 "src/parser/Parser.y"
+                    { (yyval.node) = findOrAddNode(graph,(yyvsp[0].text).start,(yyvsp[0].text).length); }
+#line 1324 "src/parser/Parser.c"
     break;
 
-  case 34:
-#line 204 "src/parser/Parser.y"
-                    { 
-                      (yyval.name) = (char*)malloc((strlen((yyvsp[-1].name))+1)*sizeof(char)); strcpy((yyval.name),(yyvsp[-1].name));
-                      if(graph->nodes == NULL) graph->nodes = addNode((yyvsp[-1].name),false,false,NULL,NULL); else addOrUpdateNode((yyvsp[-1].name),false,false,NULL,graph->nodes);
-                    }
-#line 1569 "src/parser/Parser.c"
+  case 34: /* node_id: T_ID port  */
+#line 212 "src/parser/Parser.y"
+                    { (yyval.node) = findOrAddNode(graph,(yyvsp[-1].text).start,(yyvsp[-1].text).length); }
+#line 1330 "src/parser/Parser.c"
     break;
 
-  case 42:
-#line 223 "src/parser/Parser.y"
-                                    { //printf("edge seen: (%s,%s)\n",$1,$2);
-                                      graph->edges = addEdge((yyvsp[-1].name),(yyvsp[0].name),graph->edges);
-                                      free((yyvsp[-1].name)); free((yyvsp[0].name));
+  case 42: /* edge_stmt: node_id edgerhs  */
+#line 228 "src/parser/Parser.y"
+                                    { //printf("edge seen: (%d,%d)\n",$1,$2);
+                                      addEdge(graph,(yyvsp[-1].node),(yyvsp[0].node));
                                     }
-#line 1578 "src/parser/Parser.c"
+#line 1338 "src/parser/Parser.c"
     break;
 
-  case 43:
-#line 227 "src/parser/Parser.y"
-                                    { //printf("edge seen: (%s,%s)\n",$1,$2);
-                                      graph->edges = addEdge((yyvsp[-2].name),(yyvsp[-1].name),graph->edges);
-                                      free((yyvsp[-2].name)); free((yyvsp[-1].name));
+  case 43: /* edge_stmt: node_id edgerhs attr_list  */
+#line 231 "src/parser/Parser.y"
+                                    { //printf("edge seen: (%d,%d)\n",$1,$2);
+                                      addEdge(graph,(yyvsp[-2].node),(yyvsp[-1].node));
                                     }
-#line 1587 "src/parser/Parser.c"
+#line 1346 "src/parser/Parser.c"
     break;
 
-  case 46:
-#line 235 "src/parser/Parser.y"
+  case 46: /* edgerhs: edgeop node_id  */
+#line 238 "src/parser/Parser.y"
                                 { //printf("edge end seen\n");
-                                  (yyval.name) = (yyvsp[0].name);
+                                  (yyval.node) = (yyvsp[0].node);
                                 }
-#line 1595 "src/parser/Parser.c"
+#line 1354 "src/parser/Parser.c"
     break;
 
-  case 47:
-#line 238 "src/parser/Parser.y"
+  case 47: /* edgerhs: edgeop node_id edgerhs  */
+#line 241 "src/parser/Parser.y"
                                 {
-                                  graph->edges = addEdge((yyvsp[-1].name),(yyvsp[0].name),graph->edges);
-                                  free((yyvsp[0].name));
-                                  (yyval.name) = (yyvsp[-1].name);
+                                  addEdge(graph,(yyvsp[-1].node),(yyvsp[0].node));
+                                  (yyval.node) = (yyvsp[-1].node);
                                 }
-#line 1605 "src/parser/Parser.c"
+#line 1363 "src/parser/Parser.c"
     break;
 
 
-#line 1609 "src/parser/Parser.c"
+#line 1367 "src/parser/Parser.c"
 
       default: break;
     }
@@ -1620,11 +1378,10 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
@@ -1648,50 +1405,14 @@ yyreduce:
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
       yyerror (graph, scanner, YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
-      {
-        char const *yymsgp = YY_("syntax error");
-        int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
-        if (yysyntax_error_status == 0)
-          yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
-          {
-            if (yymsg != yymsgbuf)
-              YYSTACK_FREE (yymsg);
-            yymsg = YY_CAST (char *, YYSTACK_ALLOC (YY_CAST (YYSIZE_T, yymsg_alloc)));
-            if (!yymsg)
-              {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
-              }
-            else
-              {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
-              }
-          }
-        yyerror (graph, scanner, yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
-      }
-# undef YYSYNTAX_ERROR
-#endif
     }
 
-
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
@@ -1724,6 +1445,7 @@ yyerrorlab:
      label yyerrorlab therefore never appears in user code.  */
   if (0)
     YYERROR;
+  ++yynerrs;
 
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
@@ -1740,13 +1462,14 @@ yyerrorlab:
 yyerrlab1:
   yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
         {
-          yyn += YYTERROR;
-          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
             {
               yyn = yytable[yyn];
               if (0 < yyn)
@@ -1760,7 +1483,7 @@ yyerrlab1:
 
 
       yydestruct ("Error: popping",
-                  yystos[yystate], yyvsp, graph, scanner);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, graph, scanner);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -1772,7 +1495,7 @@ yyerrlab1:
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -1783,7 +1506,7 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
 
 
 /*-----------------------------------.
@@ -1791,24 +1514,22 @@ yyacceptlab:
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
 
-#if !defined yyoverflow || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (graph, scanner, YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
 
 
-/*-----------------------------------------------------.
-| yyreturn -- parsing is finished, return the result.  |
-`-----------------------------------------------------*/
-yyreturn:
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
   if (yychar != YYEMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
@@ -1824,20 +1545,18 @@ yyreturn:
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-                  yystos[+*yyssp], yyvsp, graph, scanner);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, graph, scanner);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
+
   return yyresult;
 }
-#line 254 "src/parser/Parser.y"
+
+#line 256 "src/parser/Parser.y"
 
 
 #include <stdio.h>
@@ -1847,7 +1566,6 @@ yyreturn:
 #include <fcntl.h>
 #include <errno.h>
 
-extern int column;
 //extern FILE *yyin; //remove for version 3.0.4 and g++ v6.3.0
 
 /*int yyerror(char *s)
@@ -1,8 +1,8 @@
-/* A Bison parser, made by GNU Bison 3.5.1.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison interface for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2020 Free Software Foundation,
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
    Inc.
 
    This program is free software: you can redistribute it and/or modify
@@ -16,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -31,8 +31,9 @@
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
-/* Undocumented macros, especially those whose name start with YY_,
-   are private implementation details.  Do not rely on them.  */
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
 
 #ifndef YY_YY_SRC_PARSER_PARSER_H_INCLUDED
 # define YY_YY_SRC_PARSER_PARSER_H_INCLUDED
@@ -44,56 +45,72 @@
 extern int yydebug;
 #endif
 /* "%code requires" blocks.  */
-#line 29 "src/parser/Parser.y"
+#line 42 "src/parser/Parser.y"
 
   typedef void* yyscan_t;
+  /* The state of a parsing, kept in the extra data of the lexer (see yylex_init_extra) so that several graphs can be parsed at the same time. */
+  typedef struct {
+      const char* fileName; /* The name of the parsed file, for error messages. */
+      int line;             /* The current line. */
+  } parserState;
+  /* The text of a token: it points into the buffer scanned by the lexer, and is not terminated by '\0'. */
+  typedef struct {
+      const char* start;
+      int length;
+  } textSlice;
   enum stateType {None,Init,Final,InitFinal};
   typedef struct {
       enum stateType automataInfo;
-      char* color;
+      textSlice color; /* start is NULL if there is no color. */
   } stateInformation;
 
-#line 57 "src/parser/Parser.h"
+#line 68 "src/parser/Parser.h"
 
-/* Token type.  */
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
   enum yytokentype
   {
-    T_LPAREN = 258,
-    T_RPAREN = 259,
-    T_COMMA = 260,
-    T_COLON = 261,
-    T_SEMI = 262,
-    T_AT = 263,
-    T_LBRACKET = 264,
-    T_RBRACKET = 265,
-    T_LBRACE = 266,
-    T_RBRACE = 267,
-    T_STRING = 268,
-    T_EQ = 269,
-    T_DIGRAPH = 270,
-    T_EDGE = 271,
-    T_DEDGE = 272,
-    T_UEDGE = 273,
-    T_GRAPH = 274,
-    T_ID = 275,
-    T_NODE = 276,
-    T_STRICT = 277,
-    T_SUBGRAPH = 278
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    T_LPAREN = 258,                /* T_LPAREN  */
+    T_RPAREN = 259,                /* T_RPAREN  */
+    T_COMMA = 260,                 /* T_COMMA  */
+    T_COLON = 261,                 /* T_COLON  */
+    T_SEMI = 262,                  /* T_SEMI  */
+    T_AT = 263,                    /* T_AT  */
+    T_LBRACKET = 264,              /* T_LBRACKET  */
+    T_RBRACKET = 265,              /* T_RBRACKET  */
+    T_LBRACE = 266,                /* T_LBRACE  */
+    T_RBRACE = 267,                /* T_RBRACE  */
+    T_STRING = 268,                /* T_STRING  */
+    T_EQ = 269,                    /* T_EQ  */
+    T_DIGRAPH = 270,               /* T_DIGRAPH  */
+    T_EDGE = 271,                  /* T_EDGE  */
+    T_DEDGE = 272,                 /* T_DEDGE  */
+    T_UEDGE = 273,                 /* T_UEDGE  */
+    T_GRAPH = 274,                 /* T_GRAPH  */
+    T_ID = 275,                    /* T_ID  */
+    T_NODE = 276,                  /* T_NODE  */
+    T_STRICT = 277,                /* T_STRICT  */
+    T_SUBGRAPH = 278               /* T_SUBGRAPH  */
   };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
 union YYSTYPE
 {
-#line 49 "src/parser/Parser.y"
+#line 72 "src/parser/Parser.y"
 
-    char* name;
+    textSlice text;
+    int node;
     stateInformation stateInfo;
 
-#line 97 "src/parser/Parser.h"
+#line 114 "src/parser/Parser.h"
 
 };
 typedef union YYSTYPE YYSTYPE;
@@ -103,6 +120,8 @@ typedef union YYSTYPE YYSTYPE;
 
 
 
+
 int yyparse (GraphList *graph, yyscan_t scanner);
 
+
 #endif /* !YY_YY_SRC_PARSER_PARSER_H_INCLUDED  */
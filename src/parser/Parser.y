@@ -13,6 +13,7 @@
  * 
  */
  
+#include <string.h>
 #include "GraphList.h"
 #include "Parser.h"
 #include "Lexer.h"
@@ -20,18 +21,40 @@
 
 int yyerror(GraphList *expression, yyscan_t scanner, const char *msg) {
     /* Add error handling routine as needed */
-    printf("Erreur: %s\n",msg);
+    parserState *state = yyget_extra(scanner);
+    printf("Erreur: %s:%d: %s\n",state->fileName,state->line,msg);
     return 0;
 }
+
+/**
+ * @brief Tells if a token is a given keyword.
+ *
+ * @param token the token.
+ * @param keyword the keyword.
+ * @return true if the text of @p token is @p keyword.
+ */
+static bool isKeyword(textSlice token, const char *keyword) {
+    return strlen(keyword) == (size_t)token.length && strncmp(token.start, keyword, token.length) == 0;
+}
  
 %}
 
 %code requires {
   typedef void* yyscan_t;
+  /* The state of a parsing, kept in the extra data of the lexer (see yylex_init_extra) so that several graphs can be parsed at the same time. */
+  typedef struct {
+      const char* fileName; /* The name of the parsed file, for error messages. */
+      int line;             /* The current line. */
+  } parserState;
+  /* The text of a token: it points into the buffer scanned by the lexer, and is not terminated by '\0'. */
+  typedef struct {
+      const char* start;
+      int length;
+  } textSlice;
   enum stateType {None,Init,Final,InitFinal};
   typedef struct {
       enum stateType automataInfo;
-      char* color;
+      textSlice color; /* start is NULL if there is no color. */
   } stateInformation;
 }
 
@@ -47,7 +70,8 @@ int yyerror(GraphList *expression, yyscan_t scanner, const char *msg) {
 
 
 %union {
-    char* name;
+    textSlice text;
+    int node;
     stateInformation stateInfo;
 }
 
@@ -62,14 +86,14 @@ int yyerror(GraphList *expression, yyscan_t scanner, const char *msg) {
 %token T_RBRACKET
 %token T_LBRACE
 %token T_RBRACE
-%token <name> T_STRING
+%token <text> T_STRING
 %token T_EQ
 %token T_DIGRAPH
 %token T_EDGE
 %token T_DEDGE
 %token T_UEDGE
 %token T_GRAPH
-%token <name> T_ID
+%token <text> T_ID
 %token T_NODE
 %token T_STRICT
 %token T_SUBGRAPH
@@ -78,12 +102,12 @@ int yyerror(GraphList *expression, yyscan_t scanner, const char *msg) {
 /*declare non-terminal symbols here.*/
 //%type <expression> edgeDescription
 
-%type <name> node_id;
-%type <name> edgerhs;
+%type <node> node_id;
+%type <node> edgerhs;
 %type <stateInfo> attr_assignment;
 %type <stateInfo> a_list;
 %type <stateInfo> attr_list;
-%type <name> idrhs;
+%type <text> idrhs;
 
 
 
@@ -125,7 +149,7 @@ attr_stmt : T_GRAPH attr_list
     ;
 
 attr_list : T_LBRACKET a_list T_RBRACKET        { $$ = $2; }
-    | T_LBRACKET T_RBRACKET                     { $$.automataInfo = None; $$.color=NULL; }
+    | T_LBRACKET T_RBRACKET                     { $$.automataInfo = None; $$.color.start=NULL; }
     | T_LBRACKET a_list T_RBRACKET attr_list    { if($2.automataInfo == None) $$.automataInfo = $4.automataInfo;
                                                   else{
                                                      if($4.automataInfo== None) $$.automataInfo = $2.automataInfo;
@@ -134,11 +158,8 @@ attr_list : T_LBRACKET a_list T_RBRACKET        { $$ = $2; }
                                                         else $$.automataInfo = $2.automataInfo;
                                                         }
                                                     }
-                                                if($2.color == NULL) $$.color = $4.color;
-                                                else {
-                                                    if($4.color != NULL) free($4.color);
-                                                    $$.color = $2.color;
-                                                    }
+                                                if($2.color.start == NULL) $$.color = $4.color;
+                                                else $$.color = $2.color;
                                                 }
     | T_LBRACKET T_RBRACKET attr_list           { $$ = $3; }
     ;
@@ -152,11 +173,8 @@ a_list : attr_assignment                { $$ = $1;}
                                                   else $$.automataInfo = $1.automataInfo;
                                               }
                                           }
-                                            if($1.color == NULL) $$.color = $3.color;
-                                            else {
-                                                if($3.color != NULL) free($3.color);
-                                                $$.color = $1.color;
-                                                }
+                                            if($1.color.start == NULL) $$.color = $3.color;
+                                            else $$.color = $1.color;
                                           }
     | attr_assignment a_list            { if($1.automataInfo == None) $$.automataInfo = $2.automataInfo;
                                           else{
@@ -166,45 +184,32 @@ a_list : attr_assignment                { $$ = $1;}
                                                   else $$.automataInfo = $1.automataInfo;
                                               }
                                           }
-                                            if($1.color == NULL) $$.color = $2.color;
-                                            else {
-                                                if($2.color != NULL) free($2.color);
-                                                $$.color = $1.color;
-                                                }
+                                            if($1.color.start == NULL) $$.color = $2.color;
+                                            else $$.color = $1.color;
                                           }
     ;
 
 attr_assignment : idrhs T_EQ idrhs   { 
-     if(strcmp($1,"color")==0) { $$.automataInfo = None; $$.color = $3; free($1);} else { $$.color=NULL; if (strcmp($1,"initial")==0) $$.automataInfo = Init; else if(strcmp($1,"final")==0) $$.automataInfo = Final; else $$.automataInfo = None; free($1); free($3);}}
+     if(isKeyword($1,"color")) { $$.automataInfo = None; $$.color = $3;} else { $$.color.start=NULL; if (isKeyword($1,"initial")) $$.automataInfo = Init; else if(isKeyword($1,"final")) $$.automataInfo = Final; else $$.automataInfo = None;}}
     ;
 								
-idrhs : T_ID        { $$ = (char*)malloc((strlen($1)+1)*sizeof(char)); strcpy($$,$1);
-                    }
-    | T_STRING      { $$ = (char*)malloc((strlen($1)+1)*sizeof(char)); strcpy($$,$1);
-                    }
+idrhs : T_ID        { $$ = $1; }
+    | T_STRING      { $$ = $1; }
 		;        
 
 node_stmt : node_id 
     | node_id attr_list     {   switch($2.automataInfo)
                                 {
-                                    case Init: if(graph->nodes == NULL) graph->nodes = addNode($1,true,false,$2.color,NULL); else addOrUpdateNode($1,true,false,$2.color,graph->nodes); break;
-                                    case Final: if(graph->nodes == NULL) graph->nodes = addNode($1,false,true,$2.color,NULL); else addOrUpdateNode($1,false,true,$2.color,graph->nodes); break;
-                                    case InitFinal: if(graph->nodes == NULL) graph->nodes = addNode($1,true,true,$2.color,NULL); else addOrUpdateNode($1,true,true,$2.color,graph->nodes); break;
-                                    case None: if(graph->nodes == NULL) graph->nodes = addNode($1,false,false,$2.color,NULL); else addOrUpdateNode($1,false,false,$2.color,graph->nodes); break;
+                                    case Init: updateNode(graph,$1,true,false,$2.color.start,$2.color.length); break;
+                                    case Final: updateNode(graph,$1,false,true,$2.color.start,$2.color.length); break;
+                                    case InitFinal: updateNode(graph,$1,true,true,$2.color.start,$2.color.length); break;
+                                    case None: updateNode(graph,$1,false,false,$2.color.start,$2.color.length); break;
                                 }
-                                free($1);
-                                if($2.color!=NULL) free($2.color);
                             }
     ;
 
-node_id : T_ID      { 
-                      $$ = (char*)malloc((strlen($1)+1)*sizeof(char)); strcpy($$,$1);
-                      if(graph->nodes == NULL) graph->nodes = addNode($1,false,false,NULL,NULL); else addOrUpdateNode($1,false,false,NULL,graph->nodes);
-                    }
-    | T_ID port     { 
-                      $$ = (char*)malloc((strlen($1)+1)*sizeof(char)); strcpy($$,$1);
-                      if(graph->nodes == NULL) graph->nodes = addNode($1,false,false,NULL,NULL); else addOrUpdateNode($1,false,false,NULL,graph->nodes);
-                    }
+node_id : T_ID      { $$ = findOrAddNode(graph,$1.start,$1.length); }
+    | T_ID port     { $$ = findOrAddNode(graph,$1.start,$1.length); }
     ;
 
 port : port_location 
@@ -220,13 +225,11 @@ port_location : T_COLON T_ID
 port_angle : T_AT T_ID
     ;
 
-edge_stmt : node_id edgerhs         { //printf("edge seen: (%s,%s)\n",$1,$2);
-                                      graph->edges = addEdge($1,$2,graph->edges);
-                                      free($1); free($2);
+edge_stmt : node_id edgerhs         { //printf("edge seen: (%d,%d)\n",$1,$2);
+                                      addEdge(graph,$1,$2);
                                     }
-    | node_id edgerhs attr_list     { //printf("edge seen: (%s,%s)\n",$1,$2);
-                                      graph->edges = addEdge($1,$2,graph->edges);
-                                      free($1); free($2);
+    | node_id edgerhs attr_list     { //printf("edge seen: (%d,%d)\n",$1,$2);
+                                      addEdge(graph,$1,$2);
                                     }
     | subgraph edgerhs 
     | subgraph edgerhs attr_list 
@@ -236,8 +239,7 @@ edgerhs : edgeop node_id        { //printf("edge end seen\n");
                                   $$ = $2;
                                 }
     | edgeop node_id edgerhs    {
-                                  graph->edges = addEdge($2,$3,graph->edges);
-                                  free($3);
+                                  addEdge(graph,$2,$3);
                                   $$ = $2;
                                 }
     ;
@@ -260,7 +262,6 @@ edgeop   : T_UEDGE
 #include <fcntl.h>
 #include <errno.h>
 
-extern int column;
 //extern FILE *yyin; //remove for version 3.0.4 and g++ v6.3.0
 
 /*int yyerror(char *s)
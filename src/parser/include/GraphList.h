@@ -2,8 +2,9 @@
  * @file GraphList.h
  * @author Vincent Penelle (vincent.penelle@u-bordeaux.fr)
  * @brief  Structure to store a graph that can be dynamically modified. Used as a temporary structure during parsing before translating into a more static structure.
- * @version 2
- * @date 2019-07-22, 2020-06-25
+ *         Nodes and edges are stored in growable arrays filled directly by the actions of the parser, and the names of the nodes are stored once in a single block, which becomes the one of the final graph.
+ * @version 3
+ * @date 2019-07-22, 2020-06-25, 2026-10-16
  * 
  * @copyright Creative Commons.
  * 
@@ -12,18 +13,70 @@
 #ifndef COCA_GRAPHLIST_H_
 #define COCA_GRAPHLIST_H_
 
-#include "EdgeList.h"
-#include "NodeList.h"
+#include <stdbool.h>
+#include "NameTable.h"
 
 /**
- * @brief The EdgeList structure. Contains a list of nodes and a list of edges.
+ * @brief The GraphList structure. Contains the nodes, numbered in the order of their first mention, with their attributes, and the edges between these numbers.
  */
 typedef struct tagGraphList
 {
-	SNodeList *nodes;
-    SEdgeList *edges;
+    SNameTable nodes;       ///< The names of the nodes.
+    int nodeCapacity;       ///< The size of the arrays initial, final and colors.
+    bool *initial;          ///< Tells if each node is initial.
+    bool *final;            ///< Tells if each node is final.
+    int *colors;            ///< The number of the color of each node in colorNames, -1 if it has none.
+    SNameTable colorNames;  ///< The names of the colors.
+    int numEdges;           ///< The number of edges.
+    int edgeCapacity;       ///< The number of edges that edges can contain.
+    int *edges;             ///< The ends of the edge i are edges[2*i] and edges[2*i+1].
     bool directed;
 } GraphList;
 
+/**
+ * @brief Initialises an empty GraphList.
+ * 
+ * @param graph the GraphList.
+ */
+void initGraphList(GraphList *graph);
+
+/**
+ * @brief Returns the number of a node, adding it to the graph with the next number if it is not present.
+ * 
+ * @param graph the graph to modify.
+ * @param n the name of the node, which does not need to be terminated by '\0'.
+ * @param length the length of @p n.
+ * @return int the number of the node.
+ */
+int findOrAddNode(GraphList *graph, const char *n, size_t length);
+
+/**
+ * @brief Updates the initial and final status of a node with the arguments given.
+ * 
+ * @param graph the graph to modify.
+ * @param node the number of the node.
+ * @param isInit tells if the node is initial.
+ * @param isFinal tells if the node is final.
+ * @param col the color of the node, which does not need to be terminated by '\0', only used if the node has no color yet. May be NULL.
+ * @param colLength the length of @p col.
+ */
+void updateNode(GraphList *graph, int node, bool isInit, bool isFinal, const char *col, size_t colLength);
+
+/**
+ * @brief Adds an edge to the graph.
+ * 
+ * @param graph the graph to modify.
+ * @param n1 the number of the left node.
+ * @param n2 the number of the right node.
+ */
+void addEdge(GraphList *graph, int n1, int n2);
+
+/**
+ * @brief Frees the memory used by a GraphList.
+ * 
+ * @param graph the GraphList.
+ */
+void deleteGraphList(GraphList *graph);
+
 
 #endif /* DOT_PARSER_GRAPHLIST_H_ */
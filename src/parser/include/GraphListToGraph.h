@@ -17,21 +17,11 @@
 
 
 /**
- * @brief Creates a Graph object from a GraphList. Does NOT free the source, so it must be destroyed independently.
+ * @brief Creates a Graph object from a GraphList. The block of names of the nodes of the source is moved to the graph, and the source must still be destroyed independently with deleteGraphList.
  * 
  * @param source the GraphList to reinterpret as a graph.
  * @return Graph the graph corresponding to the source.
  */
-Graph createGraph(GraphList source);
-
-/**
- * @brief Auxilary function to determine the index of a node name.
- * 
- * @param list the array of node to search in.
- * @param size the size of list.
- * @param target the node to search
- * @return int the index of target in list.
- */
-int findNode(char **list,int size,char *target);
+Graph createGraph(GraphList *source);
 
 #endif /* DOT_PARSER_GRAPHLISTTOGRAPH_H_ */
\ No newline at end of file
@@ -0,0 +1,88 @@
+/**
+ * @file NameTable.h
+ * @brief  Hash table numbering the names (of nodes, of colors) met during parsing. Names are numbered from 0 in the
+ *         order of their first insertion, and stored one after the other in a single growable block of characters, so
+ *         that inserting a name allocates nothing most of the time. Looking a name up takes constant time on average.
+ * @version 1
+ * @date 2026-10-16
+ *
+ * @copyright Creative Commons.
+ *
+ */
+
+#ifndef COCA_NAMETABLE_H_
+#define COCA_NAMETABLE_H_
+
+#include <stddef.h>
+
+/**
+ * @brief The NameTable structure. The name numbered i starts at strings + offsets[i] and is terminated by '\0'. The
+ *        slots map the hash of a name to its number (open addressing with linear probing).
+ */
+typedef struct tagSNameTable
+{
+    int numNames;           ///< The number of names.
+    int capacity;           ///< The size of the arrays offsets and hashes.
+    size_t *offsets;        ///< The offset of each name in strings.
+    unsigned int *hashes;   ///< The hash of each name.
+    char *strings;          ///< The names, one after the other.
+    size_t stringsSize;     ///< The number of characters used in strings.
+    size_t stringsCapacity; ///< The size of strings.
+    int *slots;             ///< The number of the name in each slot, -1 for an empty slot.
+    unsigned int numSlots;  ///< The number of slots, a power of 2 at least twice the capacity.
+} SNameTable;
+
+/**
+ * @brief Initialises an empty table.
+ *
+ * @param table the table.
+ */
+void initNameTable(SNameTable *table);
+
+/**
+ * @brief Returns the number of a name, inserting it if it is not in the table yet.
+ *
+ * @param table the table.
+ * @param name the name, which does not need to be terminated by '\0' (its characters are copied in the table).
+ * @param length the length of @p name.
+ * @return int the number of @p name.
+ */
+int insertName(SNameTable *table, const char *name, size_t length);
+
+/**
+ * @brief Returns the number of a name.
+ *
+ * @param table the table.
+ * @param name the name, which does not need to be terminated by '\0'.
+ * @param length the length of @p name.
+ * @return int the number of @p name, -1 if it is not in the table.
+ */
+int findName(const SNameTable *table, const char *name, size_t length);
+
+/**
+ * @brief Returns a name given its number. The pointer is invalidated by the next insertion.
+ *
+ * @param table the table.
+ * @param id a number lower than table->numNames.
+ * @return const char* the name numbered @p id.
+ */
+const char *getName(const SNameTable *table, int id);
+
+/**
+ * @brief Frees the memory used by a table. The block of names is not freed if it was taken by takeNameStrings.
+ *
+ * @param table the table.
+ */
+void deleteNameTable(SNameTable *table);
+
+/**
+ * @brief Gives the block of names to the caller, who must free it. The table cannot be used anymore, except by
+ *        deleteNameTable.
+ *
+ * @param table the table.
+ * @param extraSize a number of characters to reserve after the names, for the caller's needs.
+ * @return char* the block of names, of table->stringsSize + @p extraSize characters.
+ */
+char *takeNameStrings(SNameTable *table, size_t extraSize);
+
+#endif /* COCA_NAMETABLE_H_ */
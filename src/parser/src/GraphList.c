@@ -0,0 +1,82 @@
+/**
+ * @file GraphList.c
+ * @brief  Structure to store a graph during parsing, in growable arrays filled directly by the actions of the parser.
+ * @version 1
+ * @date 2026-10-16
+ * 
+ * @copyright Creative Commons.
+ * 
+ */
+
+#include "GraphList.h"
+#include <stdlib.h>
+
+/// The number of nodes and of edges a new GraphList can contain.
+#define INITIAL_CAPACITY 64
+
+void initGraphList(GraphList *graph)
+{
+    initNameTable(&graph->nodes);
+    graph->nodeCapacity = INITIAL_CAPACITY;
+    graph->initial = (bool *)malloc(graph->nodeCapacity * sizeof(bool));
+    graph->final = (bool *)malloc(graph->nodeCapacity * sizeof(bool));
+    graph->colors = (int *)malloc(graph->nodeCapacity * sizeof(int));
+    initNameTable(&graph->colorNames);
+    graph->numEdges = 0;
+    graph->edgeCapacity = INITIAL_CAPACITY;
+    graph->edges = (int *)malloc(2 * graph->edgeCapacity * sizeof(int));
+    graph->directed = false;
+}
+
+int findOrAddNode(GraphList *graph, const char *n, size_t length)
+{
+    int numNodes = graph->nodes.numNames;
+    int node = insertName(&graph->nodes, n, length);
+
+    if (node == numNodes)
+    {
+        if (numNodes == graph->nodeCapacity)
+        {
+            graph->nodeCapacity *= 2;
+            graph->initial = (bool *)realloc(graph->initial, graph->nodeCapacity * sizeof(bool));
+            graph->final = (bool *)realloc(graph->final, graph->nodeCapacity * sizeof(bool));
+            graph->colors = (int *)realloc(graph->colors, graph->nodeCapacity * sizeof(int));
+        }
+        graph->initial[node] = false;
+        graph->final[node] = false;
+        graph->colors[node] = -1;
+    }
+    return node;
+}
+
+void updateNode(GraphList *graph, int node, bool isInit, bool isFinal, const char *col, size_t colLength)
+{
+    graph->initial[node] = graph->initial[node] || isInit;
+    graph->final[node] = graph->final[node] || isFinal;
+
+    if (graph->colors[node] == -1 && col != NULL)
+        graph->colors[node] = insertName(&graph->colorNames, col, colLength);
+}
+
+void addEdge(GraphList *graph, int n1, int n2)
+{
+    if (graph->numEdges == graph->edgeCapacity)
+    {
+        graph->edgeCapacity *= 2;
+        graph->edges = (int *)realloc(graph->edges, 2 * graph->edgeCapacity * sizeof(int));
+    }
+    graph->edges[2 * graph->numEdges] = n1;
+    graph->edges[2 * graph->numEdges + 1] = n2;
+    graph->numEdges++;
+}
+
+void deleteGraphList(GraphList *graph)
+{
+    deleteNameTable(&graph->nodes);
+    free(graph->initial);
+    free(graph->final);
+    free(graph->colors);
+    deleteNameTable(&graph->colorNames);
+    free(graph->edges);
+    graph->numEdges = 0;
+}
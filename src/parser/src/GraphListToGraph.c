@@ -1,116 +1,68 @@
 #include "GraphListToGraph.h"
-#include "EdgeList.h"
-#include "NodeList.h"
+#include "Bitset.h"
 #include <stdlib.h>
 #include <string.h>
 
-/*
- * @brief Auxilary function to determine the index of a node name.
- * 
- * @param list the array of node to search in.
- * @param size the size of list.
- * @param target the node to search
- * @return int the index of target in list.
- */
-int findNode(char **list,int size,char *target){
-	for(int i = 0; i<size;i++){
-		if(strcmp(list[i],target)==0) return i;
-	}
-	return -1;
-}
-
-Graph createGraph(GraphList source){
+Graph createGraph(GraphList *source){
 	Graph res;
 
-	res.numNodes=0;
+	res.numNodes=source->nodes.numNames;
 	res.numEdges=0;
-	SNodeList *explore = source.nodes;
-
-	int count = 0;
-	while(explore!=NULL){
-		count++;
-		explore = explore->next;
-	}
-	res.numNodes=count;
-
-	//printf("nodes: %d\n",count);
+	res.mapping=NULL;
+	res.mappingSize=0;
 
-	res.edges = (bool *)malloc(res.numNodes*res.numNodes*sizeof(bool));
+	res.edges = createBitMatrix(res.numNodes,res.numNodes);
 	res.nodes = (char **)malloc(res.numNodes*sizeof(char*));
 
 	//Ajout pour les automates.
 	res.initial = (bool *)malloc(res.numNodes*sizeof(bool));
 	res.final = (bool *)malloc(res.numNodes*sizeof(bool));
-
-	count=0;
-	explore = source.nodes;
-	//Couleurs
-	int numCol = 0;
-	char **colorTab = (char**)malloc(res.numNodes*sizeof(char*));
-
-
-	while(explore != NULL){
-		res.nodes[count] = (char *)malloc((strlen(explore->node)+1)*sizeof(char));
-		strcpy(res.nodes[count],explore->node);
-
-		//Pour les automates.
-		res.initial[count] = explore->initial;
-		res.final[count] = explore->final;
-
-		//Couleurs
-		colorTab[count] = explore->color;
-		if(colorTab[count] == NULL) colorTab[count] = "";
-		numCol++;
-		for(int i = 0; i < count; i++){
-			if(strcmp(colorTab[i],colorTab[count])==0) {numCol--;break;}
-		}
-
-		count++;
-		explore = explore->next;
-	}
-
-
-	//Couleurs
-	res.numColor = numCol;
-	res.colorNames = (char**)malloc((numCol+4)*sizeof(char*));
+	memcpy(res.initial,source->initial,res.numNodes*sizeof(bool));
+	memcpy(res.final,source->final,res.numNodes*sizeof(bool));
+
+	//Couleurs : numbered in the order of the nodes, a node without color having the color "".
+	//colorOf[c+1] is the number of the color c of colorNames in the graph, colorOf[0] the one of "".
+	int *colorOf = (int*)malloc((source->colorNames.numNames+1)*sizeof(int));
+	int *colorOrder = (int*)malloc((source->colorNames.numNames+1)*sizeof(int));
+	for(int i = 0; i <= source->colorNames.numNames; i++) colorOf[i] = -1;
+	res.numColor = 0;
 	res.color = (int*)malloc(res.numNodes*sizeof(int));
-	int maxCurrentCol=0;
-	for(int i = 0;i<res.numNodes;i++){
-		int currentCol=0;
-		while(currentCol<maxCurrentCol){
-			if(strcmp(colorTab[i],res.colorNames[currentCol])==0) { break;}
-			currentCol++;
-		}
-		res.color[i] = currentCol;
-		if(maxCurrentCol == currentCol){
-			maxCurrentCol++;
-			res.colorNames[currentCol] = (char*)malloc((strlen(colorTab[i])+1)*sizeof(char));
-			strcpy(res.colorNames[currentCol],colorTab[i]);
+	size_t colorSize = 0;
+	for(int i = 0; i < res.numNodes; i++){
+		int col = source->colors[i]+1;
+		if(colorOf[col] == -1){
+			colorOf[col] = res.numColor;
+			colorOrder[res.numColor++] = col;
+			colorSize += (col == 0 ? 0 : strlen(getName(&source->colorNames,col-1)))+1;
 		}
+		res.color[i] = colorOf[col];
 	}
 
-	free(colorTab);
-
-	/*for(int i = 0; i<res.numNodes;i++){
-		printf("%s,",res.nodes[i]);
+	//The names of the colors follow the ones of the nodes in the block of names.
+	size_t nodeSize = source->nodes.stringsSize;
+	res.names = takeNameStrings(&source->nodes,colorSize);
+	for(int i = 0; i < res.numNodes; i++) res.nodes[i] = res.names+source->nodes.offsets[i];
+	res.colorNames = (char**)malloc((res.numColor+4)*sizeof(char*));
+	char *nextColor = res.names+nodeSize;
+	for(int c = 0; c < res.numColor; c++){
+		const char *name = colorOrder[c] == 0 ? "" : getName(&source->colorNames,colorOrder[c]-1);
+		res.colorNames[c] = nextColor;
+		strcpy(nextColor,name);
+		nextColor += strlen(name)+1;
 	}
-	printf("\n");
-	*/
-
-	for(int i = 0; i<res.numNodes;i++)
-		for(int j = 0; j<res.numNodes;j++)
-			res.edges[i*res.numNodes+j] = false;
-
-	SEdgeList *exploreBis = source.edges;
-	while(exploreBis != NULL){
-		int n1,n2;
-		n1=findNode(res.nodes,res.numNodes,exploreBis->node1);
-		n2=findNode(res.nodes,res.numNodes,exploreBis->node2);
-		res.edges[n1*res.numNodes+n2] = true;
-		if(!source.directed) res.edges[n2*res.numNodes+n1] = true;
-		exploreBis = exploreBis->next;
-		res.numEdges++;
+	free(colorOf);
+	free(colorOrder);
+
+	for(int e = 0; e < source->numEdges; e++){
+		int n1 = source->edges[2*e];
+		int n2 = source->edges[2*e+1];
+		//An edge given several times is only counted once.
+		if(!isEdge(res,n1,n2)) res.numEdges++;
+		setBit(getNeighbourSet(res,n1),n2);
+		if(!source->directed) setBit(getNeighbourSet(res,n2),n1);
 	}
 
+	computeNeighbours(&res);
+
 	return res;
-}
\ No newline at end of file
+}
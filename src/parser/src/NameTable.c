@@ -0,0 +1,166 @@
+/**
+ * @file NameTable.c
+ * @brief  Hash table numbering the names (of nodes, of colors) met during parsing, with the names stored in a single
+ *         growable block of characters.
+ * @version 1
+ * @date 2026-10-16
+ *
+ * @copyright Creative Commons.
+ *
+ */
+
+#include "NameTable.h"
+#include <stdlib.h>
+#include <string.h>
+
+/// The capacity of a new table.
+#define INITIAL_CAPACITY 64
+
+/// The size of the block of names of a new table.
+#define INITIAL_STRINGS_CAPACITY 1024
+
+/**
+ * @brief Hashes a string (FNV-1a).
+ *
+ * @param name the string.
+ * @param length the length of @p name.
+ * @return unsigned int its hash.
+ */
+static unsigned int hashName(const char *name, size_t length)
+{
+    unsigned int hash = 2166136261u;
+
+    for (size_t i = 0; i < length; i++)
+    {
+        hash ^= (unsigned char)name[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * @brief Returns the slot of a name: the one containing its number, or the empty slot where it should be inserted.
+ *
+ * @param table the table.
+ * @param name the name.
+ * @param length the length of @p name.
+ * @param hash the hash of @p name.
+ * @return unsigned int the slot.
+ */
+static unsigned int findSlot(const SNameTable *table, const char *name, size_t length, unsigned int hash)
+{
+    unsigned int mask = table->numSlots - 1;
+    unsigned int slot = hash & mask;
+
+    while (table->slots[slot] != -1)
+    {
+        int id = table->slots[slot];
+        const char *candidate = table->strings + table->offsets[id];
+        if (table->hashes[id] == hash && strncmp(candidate, name, length) == 0 && candidate[length] == '\0')
+            return slot;
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+/**
+ * @brief Doubles the capacity of a table, and rehashes its names.
+ *
+ * @param table the table.
+ */
+static void growNameTable(SNameTable *table)
+{
+    table->capacity *= 2;
+    table->offsets = (size_t *)realloc(table->offsets, table->capacity * sizeof(size_t));
+    table->hashes = (unsigned int *)realloc(table->hashes, table->capacity * sizeof(unsigned int));
+
+    table->numSlots *= 2;
+    free(table->slots);
+    table->slots = (int *)malloc(table->numSlots * sizeof(int));
+    memset(table->slots, -1, table->numSlots * sizeof(int));
+    for (int id = 0; id < table->numNames; id++)
+    {
+        unsigned int slot = table->hashes[id] & (table->numSlots - 1);
+        while (table->slots[slot] != -1)
+            slot = (slot + 1) & (table->numSlots - 1);
+        table->slots[slot] = id;
+    }
+}
+
+void initNameTable(SNameTable *table)
+{
+    table->numNames = 0;
+    table->capacity = INITIAL_CAPACITY;
+    table->offsets = (size_t *)malloc(table->capacity * sizeof(size_t));
+    table->hashes = (unsigned int *)malloc(table->capacity * sizeof(unsigned int));
+    table->stringsSize = 0;
+    table->stringsCapacity = INITIAL_STRINGS_CAPACITY;
+    table->strings = (char *)malloc(table->stringsCapacity * sizeof(char));
+    table->numSlots = 2 * INITIAL_CAPACITY;
+    table->slots = (int *)malloc(table->numSlots * sizeof(int));
+    memset(table->slots, -1, table->numSlots * sizeof(int));
+}
+
+int insertName(SNameTable *table, const char *name, size_t length)
+{
+    unsigned int hash = hashName(name, length);
+    unsigned int slot = findSlot(table, name, length, hash);
+    int id = table->slots[slot];
+
+    if (id != -1)
+        return id;
+
+    if (table->numNames == table->capacity)
+    {
+        growNameTable(table);
+        slot = findSlot(table, name, length, hash);
+    }
+
+    if (table->stringsSize + length + 1 > table->stringsCapacity)
+    {
+        while (table->stringsSize + length + 1 > table->stringsCapacity)
+            table->stringsCapacity *= 2;
+        table->strings = (char *)realloc(table->strings, table->stringsCapacity * sizeof(char));
+    }
+
+    id = table->numNames++;
+    table->slots[slot] = id;
+    table->hashes[id] = hash;
+    table->offsets[id] = table->stringsSize;
+    memcpy(table->strings + table->stringsSize, name, length);
+    table->strings[table->stringsSize + length] = '\0';
+    table->stringsSize += length + 1;
+    return id;
+}
+
+int findName(const SNameTable *table, const char *name, size_t length)
+{
+    return table->slots[findSlot(table, name, length, hashName(name, length))];
+}
+
+const char *getName(const SNameTable *table, int id)
+{
+    return table->strings + table->offsets[id];
+}
+
+void deleteNameTable(SNameTable *table)
+{
+    free(table->offsets);
+    free(table->hashes);
+    free(table->strings);
+    free(table->slots);
+    table->offsets = NULL;
+    table->hashes = NULL;
+    table->strings = NULL;
+    table->slots = NULL;
+    table->numNames = 0;
+}
+
+char *takeNameStrings(SNameTable *table, size_t extraSize)
+{
+    size_t size = table->stringsSize + extraSize;
+    char *strings = (char *)realloc(table->strings, (size > 0 ? size : 1) * sizeof(char));
+
+    table->strings = NULL;
+    return strings;
+}
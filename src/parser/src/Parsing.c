@@ -2,8 +2,16 @@
 #include "Parser.h"
 #include "Lexer.h"
 #include "GraphListToGraph.h"
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 int yyparse(GraphList *expression, yyscan_t scanner);
+
+/// The number of '\0' characters flex needs at the end of a buffer it scans in place (see yy_scan_buffer).
+#define BUFFER_END_SIZE 2
  
 
 /**
@@ -15,13 +23,13 @@ int yyparse(GraphList *expression, yyscan_t scanner);
 GraphList getGraphList(const char *expr)
 {
     GraphList expression;
+    parserState parsing = {"string", 1};
     yyscan_t scanner;
     YY_BUFFER_STATE state;
 
-    expression.nodes=NULL;
-    expression.edges=NULL;
+    initGraphList(&expression);
  
-    if (yylex_init(&scanner)) {
+    if (yylex_init_extra(&parsing, &scanner)) {
         /* could not initialize */
         printf("Error initialization\n");
         return expression;
@@ -43,53 +51,115 @@ GraphList getGraphList(const char *expr)
 }
 
 /**
- * @brief Parses a file and return the GraphList described by it.
+ * @brief Parses a buffer in place and return the GraphList described by it. The tokens are slices of the buffer, so the names are only copied once, when they are stored in the GraphList.
  * 
- * @param toRead A file in graphviz format.
+ * @param buffer A buffer in graphviz format, ending with BUFFER_END_SIZE '\0' characters. The lexer temporarily writes in it.
+ * @param size The size of @p buffer, including the final '\0' characters.
+ * @param fileName The name of the file contained in @p buffer, for error messages.
  * @return GraphList The parsed GraphList.
  */
-GraphList getGraphListFromFile(FILE *toRead)
+static GraphList getGraphListFromBuffer(char *buffer, size_t size, const char *fileName)
 {
     GraphList expression;
+    parserState parsing = {fileName, 1};
     yyscan_t scanner;
     YY_BUFFER_STATE state;
 
-    expression.nodes=NULL;
-    expression.edges=NULL;
+    initGraphList(&expression);
  
-    if (yylex_init(&scanner)) {
+    if (yylex_init_extra(&parsing, &scanner)) {
         /* could not initialize */
         printf("Error initialization\n");
         return expression;
     }
 
-    state = yy_create_buffer(toRead, YY_BUF_SIZE, scanner);
-    yy_switch_to_buffer(state,scanner);
+    state = yy_scan_buffer(buffer, size, scanner);
 
     if (yyparse(&expression, scanner)) {
         /* error parsing */
         printf("Error parsing\n");
-        return expression;
     }
 
     yy_delete_buffer(state, scanner);
 
     yylex_destroy(scanner);
 
-	fclose(toRead);
-
     return expression;
 }
 
+/**
+ * @brief Maps a file in memory, followed by BUFFER_END_SIZE '\0' characters. The mapping is private: what the lexer writes in it is not written back to the file, and only the pages it writes in are copied.
+ * 
+ * @param fd A file descriptor of the file.
+ * @param fileSize The size of the file.
+ * @param mappedSize Set to the size of the mapping.
+ * @return char* The mapping, NULL if the file cannot be mapped.
+ */
+static char *mapFile(int fd, size_t fileSize, size_t *mappedSize)
+{
+    size_t pageSize = sysconf(_SC_PAGESIZE);
+    size_t size = (fileSize + BUFFER_END_SIZE + pageSize - 1) / pageSize * pageSize;
+    char *buffer;
+
+    /* The anonymous mapping provides the final '\0' characters even if the file ends on a page boundary. */
+    buffer = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (buffer == MAP_FAILED) {
+        return NULL;
+    }
+    if (fileSize > 0 && mmap(buffer, fileSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED) {
+        munmap(buffer, size);
+        return NULL;
+    }
+    *mappedSize = size;
+    return buffer;
+}
+
+/**
+ * @brief Reads a file which cannot be mapped in memory (a pipe, for example) in a buffer, followed by BUFFER_END_SIZE '\0' characters.
+ * 
+ * @param fd A file descriptor of the file.
+ * @param size Set to the size of the buffer, including the final '\0' characters.
+ * @return char* The buffer, to be freed.
+ */
+static char *readFile(int fd, size_t *size)
+{
+    size_t capacity = 65536;
+    size_t length = 0;
+    char *buffer = (char *)malloc(capacity);
+    ssize_t numRead;
+
+    while ((numRead = read(fd, buffer + length, capacity - length - BUFFER_END_SIZE)) > 0) {
+        length += numRead;
+        if (capacity - length - BUFFER_END_SIZE == 0) {
+            capacity *= 2;
+            buffer = (char *)realloc(buffer, capacity);
+        }
+    }
+    memset(buffer + length, 0, BUFFER_END_SIZE);
+    *size = length + BUFFER_END_SIZE;
+    return buffer;
+}
+
 Graph getGraphFromFile(char *toRead){
-    FILE* file = fopen(toRead,"r");
-    if(file == NULL){
+    int fd = open(toRead,O_RDONLY);
+    if(fd == -1){
         printf("file %s does not exist. Exiting.\n",toRead);
         exit(-1);
     }
-    GraphList e = getGraphListFromFile(file);
-    Graph graph = createGraph(e);
-    deleteExpression(e.edges);
-    deleteNodeList(e.nodes);
+    struct stat info;
+    char *buffer = NULL;
+    size_t size, mappedSize = 0;
+    if(fstat(fd,&info) == 0 && S_ISREG(info.st_mode)){
+        size = info.st_size + BUFFER_END_SIZE;
+        buffer = mapFile(fd,info.st_size,&mappedSize);
+    }
+    if(buffer == NULL) buffer = readFile(fd,&size);
+    close(fd);
+
+    GraphList e = getGraphListFromBuffer(buffer,size,toRead);
+    if(mappedSize > 0) munmap(buffer,mappedSize);
+    else free(buffer);
+    Graph graph = createGraph(&e);
+    deleteGraphList(&e);
     return graph;
 }